@@ -10,6 +10,7 @@
 #include <tao/pq/version.hpp>
 
 #include <tao/pq/binary.hpp>
+#include <tao/pq/md_array.hpp>
 #include <tao/pq/null.hpp>
 #include <tao/pq/oid.hpp>
 
@@ -26,9 +27,14 @@
 #include <tao/pq/parameter_traits_pair.hpp>
 #include <tao/pq/parameter_traits_tuple.hpp>
 
+#include <tao/pq/chrome_trace.hpp>
 #include <tao/pq/exception.hpp>
 #include <tao/pq/log.hpp>
+#include <tao/pq/metrics.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/slow_query_log.hpp>
+#include <tao/pq/trace.hpp>
+#include <tao/pq/try_result.hpp>
 
 #include <tao/pq/result_traits.hpp>
 #include <tao/pq/result_traits_aggregate.hpp>
@@ -37,10 +43,12 @@
 #include <tao/pq/result_traits_pair.hpp>
 #include <tao/pq/result_traits_tuple.hpp>
 
+#include <tao/pq/parallel_table_writer.hpp>
 #include <tao/pq/table_reader.hpp>
 #include <tao/pq/table_writer.hpp>
 
 #include <tao/pq/large_object.hpp>
+#include <tao/pq/large_object_streambuf.hpp>
 
 // NOLINTEND(misc-include-cleaner)
 
@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_CHROME_TRACE_HPP
+#define TAO_PQ_CHROME_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+#include <tao/pq/internal/chained_log.hpp>
+#include <tao/pq/internal/periodic_thread.hpp>
+
+namespace tao::pq
+{
+   namespace internal
+   {
+      struct chrome_trace_data;
+
+   }  // namespace internal
+
+   // writes spans for statements, transactions, pipeline syncs, COPY, and
+   // connection pool acquisitions in the Chrome Trace Event format,
+   // the file can be loaded into Perfetto or chrome://tracing. the events are
+   // written by a background thread, statements never wait for the file.
+   class chrome_trace final
+      : public internal::chained_log
+   {
+   public:
+      // the number of events that can wait for the background thread
+      static constexpr std::size_t default_buffer_size = 16 * 1024;
+
+   private:
+      std::shared_ptr< internal::chrome_trace_data > m_data;
+      internal::periodic_thread m_writer;
+
+   public:
+      explicit chrome_trace( const std::filesystem::path& path, const std::size_t buffer_size = default_buffer_size );
+
+      chrome_trace( const chrome_trace& ) = delete;
+      chrome_trace( chrome_trace&& ) = delete;
+      void operator=( const chrome_trace& ) = delete;
+      void operator=( chrome_trace&& ) = delete;
+
+      // completes the file, later events are ignored
+      ~chrome_trace();
+
+      // writes the buffered events to the file
+      void flush();
+
+      // the number of events that were lost because the buffer was full
+      [[nodiscard]] auto dropped() const noexcept -> std::uint64_t;
+   };
+
+}  // namespace tao::pq
+
+#endif
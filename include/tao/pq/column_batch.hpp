@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_COLUMN_BATCH_HPP
+#define TAO_PQ_COLUMN_BATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <tao/pq/result_traits.hpp>
+
+namespace tao::pq
+{
+   class table_reader;
+
+   // rows stored as one vector per column, NULL values are default constructed
+   // and marked with a one in the column's null mask.
+   // views and pointers are rejected, they would not outlive the current row of the table_reader
+   template< typename... Ts >
+      requires( ( result_type_direct< Ts > && ( result_traits_size< Ts > == 1 ) && std::is_default_constructible_v< Ts > && !std::is_pointer_v< Ts > && !std::is_same_v< Ts, std::string_view > ) && ... )
+   class column_batch
+   {
+   private:
+      friend class table_reader;
+
+      std::size_t m_rows = 0;
+      std::tuple< std::vector< Ts >... > m_values;
+      std::array< std::vector< std::uint8_t >, sizeof...( Ts ) > m_nulls;
+
+      void resize( const std::size_t rows )
+      {
+         std::apply( [ & ]( auto&... vs ) { ( vs.resize( rows ), ... ); }, m_values );
+         for( auto& n : m_nulls ) {
+            n.resize( rows );
+         }
+         m_rows = rows;
+      }
+
+   public:
+      static constexpr std::size_t columns = sizeof...( Ts );
+
+      template< std::size_t I >
+      using value_type = std::tuple_element_t< I, std::tuple< Ts... > >;
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      {
+         return m_rows;
+      }
+
+      [[nodiscard]] auto empty() const noexcept -> bool
+      {
+         return m_rows == 0;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto values() const noexcept -> const std::vector< value_type< I > >&
+      {
+         return std::get< I >( m_values );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto nulls() const noexcept -> const std::vector< std::uint8_t >&
+      {
+         return std::get< I >( m_nulls );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto is_null( const std::size_t row ) const noexcept -> bool
+      {
+         return std::get< I >( m_nulls )[ row ] != 0;
+      }
+
+      void reserve( const std::size_t rows )
+      {
+         std::apply( [ & ]( auto&... vs ) { ( vs.reserve( rows ), ... ); }, m_values );
+         for( auto& n : m_nulls ) {
+            n.reserve( rows );
+         }
+      }
+
+      // keeps the capacity
+      void clear() noexcept
+      {
+         std::apply( []( auto&... vs ) { ( vs.clear(), ... ); }, m_values );
+         for( auto& n : m_nulls ) {
+            n.clear();
+         }
+         m_rows = 0;
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_COMMIT_MODE_HPP
+#define TAO_PQ_COMMIT_MODE_HPP
+
+#include <cstdint>
+#include <string_view>
+
+#include <tao/pq/internal/format_as.hpp>
+
+namespace tao::pq
+{
+   enum class commit_mode : std::uint8_t
+   {
+      independent,
+      two_phase
+   };
+
+   [[nodiscard]] constexpr auto taopq_format_as( const commit_mode cm ) noexcept -> std::string_view
+   {
+      switch( cm ) {
+         case commit_mode::independent:
+            return "independent";
+
+         case commit_mode::two_phase:
+            return "two_phase";
+
+         default:
+            return "<unknown>";
+      }
+   }
+
+}  // namespace tao::pq
+
+#endif
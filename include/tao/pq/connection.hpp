@@ -19,6 +19,7 @@
 #include <libpq-fe.h>
 
 #include <tao/pq/access_mode.hpp>
+#include <tao/pq/connection_stats.hpp>
 #include <tao/pq/connection_status.hpp>
 #include <tao/pq/internal/poll.hpp>
 #include <tao/pq/internal/zsv.hpp>
@@ -28,13 +29,16 @@
 #include <tao/pq/parameter.hpp>
 #include <tao/pq/pipeline_status.hpp>
 #include <tao/pq/poll.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/transaction.hpp>
 #include <tao/pq/transaction_base.hpp>
 #include <tao/pq/transaction_status.hpp>
+#include <tao/pq/try_result.hpp>
 
 namespace tao::pq
 {
    class connection_pool;
+   class large_object;
    class pipeline;
    class table_reader;
    class table_writer;
@@ -52,6 +56,7 @@ namespace tao::pq
    {
    private:
       friend class connection_pool;
+      friend class large_object;
       friend class table_reader;
       friend class table_writer;
       friend class transaction;
@@ -64,11 +69,13 @@ namespace tao::pq
       std::unique_ptr< PGconn, decltype( &PQfinish ) > m_pgconn;
       transaction_base* m_current_transaction;
       std::optional< std::chrono::milliseconds > m_timeout;
+      pq::result_format m_result_format = pq::result_format::text_format;
       std::set< std::string, std::less<> > m_prepared_statements;
       std::function< poll::callback > m_poll;
       std::function< void( const notification& ) > m_notification_handler;
       std::map< std::string, std::function< void( const char* ) >, std::less<> > m_notification_handlers;
       std::shared_ptr< log > m_log;
+      internal::connection_counters m_counters;
 
       [[nodiscard]] auto escape_identifier( const std::string_view identifier ) const -> std::unique_ptr< char, decltype( &PQfreemem ) >;
 
@@ -176,6 +183,17 @@ namespace tao::pq
          m_log = nullptr;
       }
 
+      // may be called from any thread
+      [[nodiscard]] auto stats() const noexcept -> connection_stats
+      {
+         return m_counters.get();
+      }
+
+      void reset_stats() noexcept
+      {
+         m_counters.reset();
+      }
+
       [[nodiscard]] auto status() const noexcept -> connection_status;
       [[nodiscard]] auto transaction_status() const noexcept -> pq::transaction_status;
 
@@ -218,6 +236,12 @@ namespace tao::pq
          return direct()->execute( statement, std::forward< As >( as )... );
       }
 
+      template< parameter_type... As >
+      [[nodiscard]] auto try_execute( const internal::zsv statement, As&&... as ) -> try_result
+      {
+         return direct()->try_execute( statement, std::forward< As >( as )... );
+      }
+
       void listen( const std::string_view channel );
       void listen( const std::string_view channel, const std::function< void( const char* payload ) >& handler );
       void unlisten( const std::string_view channel );
@@ -245,6 +269,21 @@ namespace tao::pq
          m_timeout = std::nullopt;
       }
 
+      [[nodiscard]] auto result_format() const noexcept -> pq::result_format
+      {
+         return m_result_format;
+      }
+
+      void set_result_format( const pq::result_format rf ) noexcept
+      {
+         m_result_format = rf;
+      }
+
+      void reset_result_format() noexcept
+      {
+         m_result_format = pq::result_format::text_format;
+      }
+
       [[nodiscard]] auto password( const internal::zsv passwd, const internal::zsv user, const internal::zsv algorithm = "scram-sha-256" ) -> std::string;
 
       [[nodiscard]] auto underlying_raw_ptr() noexcept -> PGconn*
@@ -17,9 +17,11 @@
 #include <tao/pq/internal/poll.hpp>
 #include <tao/pq/internal/pool.hpp>
 #include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/log.hpp>
 #include <tao/pq/parameter.hpp>
 #include <tao/pq/poll.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/try_result.hpp>
 
 namespace tao::pq
 {
@@ -30,6 +32,7 @@ namespace tao::pq
       const std::string m_connection_info;
       std::optional< std::chrono::milliseconds > m_timeout;
       std::function< poll::callback > m_poll;
+      std::shared_ptr< log > m_log;
 
    protected:
       [[nodiscard]] auto v_create() const -> std::unique_ptr< pq::connection > override;
@@ -39,6 +42,12 @@ namespace tao::pq
          return c.is_idle();
       }
 
+      void v_returned( pq::connection& c ) const noexcept override;
+      void v_pushed() const noexcept override;
+      void v_discarded( pq::connection& c ) const noexcept override;
+
+      void log_counts() const noexcept;
+
    private:
       // pass-key idiom
       class private_key final
@@ -88,6 +97,22 @@ namespace tao::pq
          m_poll = internal::poll;
       }
 
+      // set on each connection returned by connection()
+      [[nodiscard]] auto log_handler() const noexcept -> decltype( auto )
+      {
+         return m_log;
+      }
+
+      void set_log_handler( const std::shared_ptr< pq::log >& log ) noexcept
+      {
+         m_log = log;
+      }
+
+      void reset_log_handler() noexcept
+      {
+         m_log = nullptr;
+      }
+
       [[nodiscard]] auto connection() -> std::shared_ptr< pq::connection >;
 
       template< parameter_type... As >
@@ -95,6 +120,12 @@ namespace tao::pq
       {
          return connection()->direct()->execute( statement, std::forward< As >( as )... );
       }
+
+      template< parameter_type... As >
+      [[nodiscard]] auto try_execute( const internal::zsv statement, As&&... as ) -> try_result
+      {
+         return connection()->direct()->try_execute( statement, std::forward< As >( as )... );
+      }
    };
 
 }  // namespace tao::pq
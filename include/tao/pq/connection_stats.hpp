@@ -0,0 +1,121 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_CONNECTION_STATS_HPP
+#define TAO_PQ_CONNECTION_STATS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace tao::pq
+{
+   struct connection_stats
+   {
+      std::uint64_t round_trips = 0;  // results that had to be waited for
+      std::uint64_t statements_sent = 0;
+      std::uint64_t results_received = 0;
+      std::uint64_t rows_received = 0;  // including COPY rows
+      std::uint64_t bytes_sent = 0;      // statements and binary parameters, COPY data
+      std::uint64_t bytes_received = 0;  // memory used by results, COPY data
+      std::uint64_t poll_wakeups = 0;
+      std::chrono::nanoseconds wait_time = {};
+   };
+
+   namespace internal
+   {
+      // the counters are updated by the thread that uses the connection, but
+      // reset() may be called from any thread, hence the atomic increments.
+      class connection_counters final
+      {
+      private:
+         std::atomic< std::uint64_t > m_round_trips = 0;
+         std::atomic< std::uint64_t > m_statements_sent = 0;
+         std::atomic< std::uint64_t > m_results_received = 0;
+         std::atomic< std::uint64_t > m_rows_received = 0;
+         std::atomic< std::uint64_t > m_bytes_sent = 0;
+         std::atomic< std::uint64_t > m_bytes_received = 0;
+         std::atomic< std::uint64_t > m_poll_wakeups = 0;
+         std::atomic< std::int64_t > m_wait_ns = 0;
+
+         template< typename T >
+         static void add( std::atomic< T >& counter, const T value ) noexcept
+         {
+            counter.fetch_add( value, std::memory_order_relaxed );
+         }
+
+      public:
+         void round_trip() noexcept
+         {
+            add< std::uint64_t >( m_round_trips, 1 );
+         }
+
+         void statement_sent( const std::uint64_t bytes ) noexcept
+         {
+            add< std::uint64_t >( m_statements_sent, 1 );
+            add( m_bytes_sent, bytes );
+         }
+
+         void result_received( const std::uint64_t rows, const std::uint64_t bytes ) noexcept
+         {
+            add< std::uint64_t >( m_results_received, 1 );
+            add( m_rows_received, rows );
+            add( m_bytes_received, bytes );
+         }
+
+         void copy_sent( const std::uint64_t bytes ) noexcept
+         {
+            add( m_bytes_sent, bytes );
+         }
+
+         void copy_received( const std::uint64_t bytes, const bool row ) noexcept
+         {
+            if( row ) {
+               add< std::uint64_t >( m_rows_received, 1 );
+            }
+            add( m_bytes_received, bytes );
+         }
+
+         void poll_wakeup() noexcept
+         {
+            add< std::uint64_t >( m_poll_wakeups, 1 );
+         }
+
+         void waited( const std::chrono::nanoseconds duration ) noexcept
+         {
+            add< std::int64_t >( m_wait_ns, duration.count() );
+         }
+
+         [[nodiscard]] auto get() const noexcept -> connection_stats
+         {
+            connection_stats result;
+            result.round_trips = m_round_trips.load( std::memory_order_relaxed );
+            result.statements_sent = m_statements_sent.load( std::memory_order_relaxed );
+            result.results_received = m_results_received.load( std::memory_order_relaxed );
+            result.rows_received = m_rows_received.load( std::memory_order_relaxed );
+            result.bytes_sent = m_bytes_sent.load( std::memory_order_relaxed );
+            result.bytes_received = m_bytes_received.load( std::memory_order_relaxed );
+            result.poll_wakeups = m_poll_wakeups.load( std::memory_order_relaxed );
+            result.wait_time = std::chrono::nanoseconds( m_wait_ns.load( std::memory_order_relaxed ) );
+            return result;
+         }
+
+         void reset() noexcept
+         {
+            m_round_trips.store( 0, std::memory_order_relaxed );
+            m_statements_sent.store( 0, std::memory_order_relaxed );
+            m_results_received.store( 0, std::memory_order_relaxed );
+            m_rows_received.store( 0, std::memory_order_relaxed );
+            m_bytes_sent.store( 0, std::memory_order_relaxed );
+            m_bytes_received.store( 0, std::memory_order_relaxed );
+            m_poll_wakeups.store( 0, std::memory_order_relaxed );
+            m_wait_ns.store( 0, std::memory_order_relaxed );
+         }
+      };
+
+   }  // namespace internal
+
+}  // namespace tao::pq
+
+#endif
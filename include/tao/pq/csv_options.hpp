@@ -0,0 +1,23 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_CSV_OPTIONS_HPP
+#define TAO_PQ_CSV_OPTIONS_HPP
+
+#include <string>
+
+namespace tao::pq
+{
+   // must match the options of the COPY ... ( FORMAT csv ) statement,
+   // the defaults are PostgreSQL's defaults, ESCAPE must be the same as QUOTE
+   struct csv_options
+   {
+      char delimiter = ',';
+      char quote = '"';
+      std::string null;
+   };
+
+}  // namespace tao::pq
+
+#endif
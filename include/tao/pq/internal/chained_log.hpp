@@ -0,0 +1,49 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_CHAINED_LOG_HPP
+#define TAO_PQ_INTERNAL_CHAINED_LOG_HPP
+
+#include <memory>
+
+#include <tao/pq/log.hpp>
+
+namespace tao::pq
+{
+   class connection;
+   class connection_pool;
+
+}  // namespace tao::pq
+
+namespace tao::pq::internal
+{
+   // a log handler that is added to those of connections and connection pools
+   class chained_log
+   {
+   protected:
+      const std::shared_ptr< pq::log > m_log = std::make_shared< pq::log >();
+
+      chained_log() = default;
+      ~chained_log() = default;
+
+   public:
+      chained_log( const chained_log& ) = delete;
+      chained_log( chained_log&& ) = delete;
+      void operator=( const chained_log& ) = delete;
+      void operator=( chained_log&& ) = delete;
+
+      // can be extended with additional hooks
+      [[nodiscard]] auto log_handler() const noexcept -> const std::shared_ptr< pq::log >&
+      {
+         return m_log;
+      }
+
+      // chains the log handler after the current one, see pq::chain()
+      void attach( pq::connection& connection ) const;
+      void attach( pq::connection_pool& pool ) const;
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_CONNECTION_MAP_HPP
+#define TAO_PQ_INTERNAL_CONNECTION_MAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+
+namespace tao::pq::internal
+{
+   // per-connection state of a log handler, sharded by the connection's address so that
+   // connections used by different threads rarely contend for the same mutex.
+   // the state is tagged with the backend's process ID, a new connection at the address
+   // of a destroyed one does not inherit the left-over state of the old connection.
+   template< typename State >
+   class connection_map final
+   {
+   private:
+      static constexpr std::size_t shards = 16;
+
+      struct entry
+      {
+         int backend_pid = 0;
+         State state;
+      };
+
+      struct alignas( 64 ) shard
+      {
+         std::mutex mutex;
+         std::unordered_map< const connection*, entry > entries;
+      };
+
+      std::array< shard, shards > m_shards;
+
+      [[nodiscard]] auto get_shard( const connection& c ) noexcept -> shard&
+      {
+         // connections are large objects, the lower bits of their addresses carry no information
+         return m_shards[ ( std::hash< const connection* >()( &c ) >> 6 ) % shards ];
+      }
+
+   public:
+      // calls f( state ) with the state's shard locked, a missing or stale state is (re-)created,
+      // the state is removed afterwards if it is empty()
+      template< typename F >
+      void update( const connection& c, const F& f )
+      {
+         const auto pid = PQbackendPID( c.underlying_raw_ptr() );
+         auto& s = get_shard( c );
+         const std::lock_guard lock( s.mutex );
+         auto& e = s.entries[ &c ];
+         if( e.backend_pid != pid ) {
+            e = entry{ pid, State() };
+         }
+         f( e.state );
+         if( e.state.empty() ) {
+            s.entries.erase( &c );
+         }
+      }
+
+      // as above, but f( state ) is only called for an existing state that is not stale
+      template< typename F >
+      void update_existing( const connection& c, const F& f )
+      {
+         auto& s = get_shard( c );
+         const std::lock_guard lock( s.mutex );
+         const auto it = s.entries.find( &c );
+         if( it == s.entries.end() ) {
+            return;
+         }
+         if( it->second.backend_pid == PQbackendPID( c.underlying_raw_ptr() ) ) {
+            f( it->second.state );
+            if( !it->second.state.empty() ) {
+               return;
+            }
+         }
+         s.entries.erase( it );
+      }
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
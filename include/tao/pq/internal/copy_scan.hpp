@@ -0,0 +1,20 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_COPY_SCAN_HPP
+#define TAO_PQ_INTERNAL_COPY_SCAN_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace tao::pq::internal
+{
+   // scans a row of COPY's text format for '\t', '\\', and '\n' in a single pass,
+   // appends the offsets of all of them up to and including the first '\n' to
+   // positions and returns whether the row contains a backslash.
+   [[nodiscard]] auto scan_copy_row( const char* data, const std::size_t size, std::vector< std::size_t >& positions ) -> bool;
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,118 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_ENDIAN_HPP
+#define TAO_PQ_INTERNAL_ENDIAN_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#if defined( _MSC_VER )
+#include <cstdlib>
+#endif
+
+namespace tao::pq::internal
+{
+   // PostgreSQL's binary format uses network byte order (big endian)
+
+   template< std::size_t N >
+   struct uint_of_size;
+
+   template<>
+   struct uint_of_size< 1 >
+   {
+      using type = std::uint8_t;
+   };
+
+   template<>
+   struct uint_of_size< 2 >
+   {
+      using type = std::uint16_t;
+   };
+
+   template<>
+   struct uint_of_size< 4 >
+   {
+      using type = std::uint32_t;
+   };
+
+   template<>
+   struct uint_of_size< 8 >
+   {
+      using type = std::uint64_t;
+   };
+
+   template< typename T >
+   using uint_of_size_t = typename uint_of_size< sizeof( T ) >::type;
+
+   template< typename T >
+   [[nodiscard]] constexpr auto byteswap( const T v ) noexcept -> T
+   {
+      static_assert( std::is_unsigned_v< T > );
+      if constexpr( sizeof( T ) == 1 ) {
+         return v;
+      }
+#if defined( _MSC_VER )
+      else if constexpr( sizeof( T ) == 2 ) {
+         return _byteswap_ushort( v );
+      }
+      else if constexpr( sizeof( T ) == 4 ) {
+         return _byteswap_ulong( v );
+      }
+      else {
+         return _byteswap_uint64( v );
+      }
+#else
+      else if constexpr( sizeof( T ) == 2 ) {
+         return __builtin_bswap16( v );
+      }
+      else if constexpr( sizeof( T ) == 4 ) {
+         return __builtin_bswap32( v );
+      }
+      else {
+         return __builtin_bswap64( v );
+      }
+#endif
+   }
+
+   template< typename T >
+   [[nodiscard]] auto from_big_endian( const char* data ) noexcept -> T
+   {
+      static_assert( std::is_arithmetic_v< T > );
+      using U = uint_of_size_t< T >;
+      U u;
+      std::memcpy( &u, data, sizeof( U ) );
+      if constexpr( std::endian::native == std::endian::little ) {
+         u = internal::byteswap( u );
+      }
+      return std::bit_cast< T >( u );
+   }
+
+   template< typename T >
+   void to_big_endian( char* data, const T v ) noexcept
+   {
+      static_assert( std::is_arithmetic_v< T > );
+      using U = uint_of_size_t< T >;
+      auto u = std::bit_cast< U >( v );
+      if constexpr( std::endian::native == std::endian::little ) {
+         u = internal::byteswap( u );
+      }
+      std::memcpy( data, &u, sizeof( U ) );
+   }
+
+   template< typename T >
+   void append_big_endian( std::string& data, const T v )
+   {
+      char buffer[ sizeof( T ) ];
+      internal::to_big_endian( buffer, v );
+      data.append( buffer, sizeof( T ) );
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,16 @@
+// Copyright (c) 2023-2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_ERRNO_HPP
+#define TAO_PQ_INTERNAL_ERRNO_HPP
+
+#include <string>
+
+namespace tao::pq::internal
+{
+   [[nodiscard]] auto errno_to_string( const int e ) -> std::string;
+
+}  // namespace tao::pq::internal
+
+#endif
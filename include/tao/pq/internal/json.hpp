@@ -0,0 +1,18 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_JSON_HPP
+#define TAO_PQ_INTERNAL_JSON_HPP
+
+#include <string>
+#include <string_view>
+
+namespace tao::pq::internal
+{
+   // appends value as a quoted JSON string
+   void append_json( std::string& s, const std::string_view value );
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_MAPPED_FILE_HPP
+#define TAO_PQ_INTERNAL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace tao::pq::internal
+{
+   // read-only, sequentially accessed memory mapping of a whole file,
+   // falls back to reading the file into memory where mmap() is not available
+   class mapped_file final
+   {
+   private:
+      const char* m_data = nullptr;
+      std::size_t m_size = 0;
+#if defined( _WIN32 )
+      std::string m_buffer;
+#endif
+
+   public:
+      explicit mapped_file( const std::filesystem::path& path );
+      ~mapped_file();
+
+      mapped_file( const mapped_file& ) = delete;
+      mapped_file( mapped_file&& ) = delete;
+      void operator=( const mapped_file& ) = delete;
+      void operator=( mapped_file&& ) = delete;
+
+      [[nodiscard]] auto data() const noexcept -> const char*
+      {
+         return m_data;
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      {
+         return m_size;
+      }
+
+      [[nodiscard]] auto view() const noexcept -> std::string_view
+      {
+         return { m_data, m_size };
+      }
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
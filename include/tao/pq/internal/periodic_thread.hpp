@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_PERIODIC_THREAD_HPP
+#define TAO_PQ_INTERNAL_PERIODIC_THREAD_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace tao::pq::internal
+{
+   // calls a function from a background thread after each interval, and a last time when stopped,
+   // exceptions thrown by the function are ignored
+   class periodic_thread final
+   {
+   private:
+      std::mutex m_mutex;
+      std::condition_variable m_cv;
+      bool m_stop = false;
+      std::thread m_thread;
+
+   public:
+      periodic_thread( const std::chrono::milliseconds interval, std::function< void() > f );
+
+      periodic_thread( const periodic_thread& ) = delete;
+      periodic_thread( periodic_thread&& ) = delete;
+      void operator=( const periodic_thread& ) = delete;
+      void operator=( periodic_thread&& ) = delete;
+
+      ~periodic_thread();
+
+      // waits for the last call, can be called more than once
+      void stop() noexcept;
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
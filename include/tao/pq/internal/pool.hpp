@@ -52,13 +52,26 @@ namespace tao::pq::internal
       [[nodiscard]] virtual auto v_create() const -> std::unique_ptr< T > = 0;
       [[nodiscard]] virtual auto v_is_valid( T& ) const noexcept -> bool = 0;
 
+      // notifications, called without holding the lock
+      virtual void v_returned( T& /*unused*/ ) const noexcept {}  // before the item is back in the pool
+      virtual void v_pushed() const noexcept {}                  // after the item is back in the pool
+      virtual void v_discarded( T& /*unused*/ ) const noexcept {}
+
       void push( std::unique_ptr< T >& up ) noexcept
       {
          if( this->v_is_valid( *up ) ) {
+            // once published, another thread may pull and use the item
+            this->v_returned( *up );
             std::shared_ptr< T > sp( up.release(), deleter() );
-            const std::lock_guard lock( m_mutex );
-            // potentially throws -> calls abort() due to noexcept!
-            m_items.emplace_back( std::move( sp ) );
+            {
+               const std::lock_guard lock( m_mutex );
+               // potentially throws -> calls abort() due to noexcept!
+               m_items.emplace_back( std::move( sp ) );
+            }
+            this->v_pushed();
+         }
+         else {
+            this->v_discarded( *up );
          }
       }
 
@@ -121,6 +134,7 @@ namespace tao::pq::internal
                ++m_attached;
                return sp;
             }
+            this->v_discarded( *sp );
          }
          return create();
       }
@@ -145,16 +159,21 @@ namespace tao::pq::internal
       void erase_invalid()
       {
          std::list< std::shared_ptr< T > > deferred_delete;
-         const std::lock_guard lock( m_mutex );
-         auto it = m_items.begin();
-         while( it != m_items.end() ) {
-            if( !this->v_is_valid( **it ) ) {
-               deferred_delete.splice( deferred_delete.end(), m_items, it++ );
-            }
-            else {
-               ++it;
+         {
+            const std::lock_guard lock( m_mutex );
+            auto it = m_items.begin();
+            while( it != m_items.end() ) {
+               if( !this->v_is_valid( **it ) ) {
+                  deferred_delete.splice( deferred_delete.end(), m_items, it++ );
+               }
+               else {
+                  ++it;
+               }
             }
          }
+         for( const auto& sp : deferred_delete ) {
+            this->v_discarded( *sp );
+         }
       }
    };
 
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_RING_BUFFER_HPP
+#define TAO_PQ_INTERNAL_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace tao::pq::internal
+{
+   // bounded lock-free queue for multiple producers and a single consumer,
+   // each slot carries a sequence number that tells whether it is free or filled.
+   template< typename T >
+   class ring_buffer final
+   {
+   private:
+      struct slot
+      {
+         std::atomic< std::size_t > sequence;
+         T value;
+      };
+
+      const std::size_t m_mask;
+      const std::unique_ptr< slot[] > m_slots;
+
+      alignas( 64 ) std::atomic< std::size_t > m_head = 0;
+      alignas( 64 ) std::size_t m_tail = 0;
+
+      [[nodiscard]] static auto distance( const std::size_t lhs, const std::size_t rhs ) noexcept -> std::intptr_t
+      {
+         return static_cast< std::intptr_t >( lhs - rhs );
+      }
+
+   public:
+      // the capacity is rounded up to a power of two
+      explicit ring_buffer( const std::size_t capacity )
+         : m_mask( std::bit_ceil( std::max< std::size_t >( capacity, 2 ) ) - 1 ),
+           m_slots( std::make_unique< slot[] >( m_mask + 1 ) )
+      {
+         for( std::size_t i = 0; i <= m_mask; ++i ) {
+            m_slots[ i ].sequence.store( i, std::memory_order_relaxed );
+         }
+      }
+
+      ring_buffer( const ring_buffer& ) = delete;
+      ring_buffer( ring_buffer&& ) = delete;
+      void operator=( const ring_buffer& ) = delete;
+      void operator=( ring_buffer&& ) = delete;
+
+      ~ring_buffer() = default;
+
+      [[nodiscard]] auto capacity() const noexcept -> std::size_t
+      {
+         return m_mask + 1;
+      }
+
+      // returns false if the buffer is full, never blocks
+      [[nodiscard]] auto try_push( T&& value ) noexcept -> bool
+      {
+         auto pos = m_head.load( std::memory_order_relaxed );
+         while( true ) {
+            auto& s = m_slots[ pos & m_mask ];
+            const auto d = distance( s.sequence.load( std::memory_order_acquire ), pos );
+            if( d == 0 ) {
+               if( m_head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) {
+                  s.value = std::move( value );
+                  s.sequence.store( pos + 1, std::memory_order_release );
+                  return true;
+               }
+            }
+            else if( d < 0 ) {
+               return false;
+            }
+            else {
+               pos = m_head.load( std::memory_order_relaxed );
+            }
+         }
+      }
+
+      // must only be called by a single consumer at a time
+      [[nodiscard]] auto try_pop( T& value ) noexcept -> bool
+      {
+         auto& s = m_slots[ m_tail & m_mask ];
+         if( distance( s.sequence.load( std::memory_order_acquire ), m_tail + 1 ) < 0 ) {
+            return false;
+         }
+         value = std::move( s.value );
+         s.sequence.store( m_tail + m_mask + 1, std::memory_order_release );
+         ++m_tail;
+         return true;
+      }
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,184 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_STATEMENT_TRACKER_HPP
+#define TAO_PQ_INTERNAL_STATEMENT_TRACKER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/internal/connection_map.hpp>
+#include <tao/pq/log.hpp>
+#include <tao/pq/poll.hpp>
+
+namespace tao::pq::internal
+{
+   // follows each statement from sending it until its final result was received,
+   // Payload is what the derived class attaches to a statement when it is sent.
+   template< typename Payload >
+   class statement_tracker
+   {
+   public:
+      using clock = std::chrono::steady_clock;
+
+      struct tracked
+      {
+         Payload payload;
+         clock::time_point start;     // before passing the statement to libpq
+         clock::time_point sent;      // after libpq queued the statement
+         clock::time_point received;  // when the result started arriving
+         std::uint64_t rows = 0;      // of the results before the final one in single row or chunk mode
+      };
+
+   private:
+      // pipeline mode allows several pending statements per connection
+      struct connection_state
+      {
+         std::deque< tracked > queue;
+         clock::time_point get_result;
+         std::optional< clock::time_point > readable;
+
+         [[nodiscard]] auto empty() const noexcept -> bool
+         {
+            return queue.empty();
+         }
+      };
+
+      connection_map< connection_state > m_connections;
+
+      void send( const connection& c, const char* statement, const int n_params, const char* const values[], const int lengths[], const int formats[] )
+      {
+         const auto start = clock::now();
+         auto payload = v_sent( c, statement, n_params, values, lengths, formats );
+         m_connections.update( c, [ & ]( connection_state& s ) {
+            s.queue.push_back( { std::move( payload ), start, start, start, 0 } );
+         } );
+      }
+
+      void send_result( const connection& c, const int result )
+      {
+         const auto now = clock::now();
+         std::optional< tracked > failed;
+         m_connections.update_existing( c, [ & ]( connection_state& s ) {
+            if( result == 0 ) {
+               failed = std::move( s.queue.back() );
+               s.queue.pop_back();
+            }
+            else {
+               s.queue.back().sent = now;
+            }
+         } );
+         if( failed ) {
+            v_failed( c, *failed );
+         }
+      }
+
+      void get_result( const connection& c )
+      {
+         const auto now = clock::now();
+         m_connections.update_existing( c, [ & ]( connection_state& s ) {
+            s.get_result = now;
+            s.readable.reset();
+         } );
+      }
+
+      void readable( const connection& c )
+      {
+         const auto now = clock::now();
+         m_connections.update_existing( c, [ & ]( connection_state& s ) {
+            if( !s.readable ) {
+               s.readable = now;
+            }
+         } );
+      }
+
+      void result( const connection& c, const PGresult* result )
+      {
+         if( result == nullptr ) {
+            return;
+         }
+         const auto status = PQresultStatus( result );
+         const bool partial = ( status == PGRES_SINGLE_TUPLE )
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+                              || ( status == PGRES_TUPLES_CHUNK )
+#endif
+            ;
+         const auto now = clock::now();
+         std::optional< tracked > t;
+         if( status != PGRES_PIPELINE_SYNC ) {
+            m_connections.update_existing( c, [ & ]( connection_state& s ) {
+               if( partial ) {
+                  s.queue.front().rows += static_cast< std::uint64_t >( PQntuples( result ) );
+                  return;
+               }
+               t = std::move( s.queue.front() );
+               s.queue.pop_front();
+               t->received = std::max( s.readable.value_or( s.get_result ), t->sent );
+            } );
+         }
+         if( !partial ) {
+            v_completed( c, result, t ? &*t : nullptr, now );
+         }
+      }
+
+   protected:
+      statement_tracker() = default;
+      virtual ~statement_tracker() = default;
+
+      // the notifications are called from the thread that uses the connection
+      [[nodiscard]] virtual auto v_sent( const connection& c, const char* statement, const int n_params, const char* const values[], const int lengths[], const int formats[] ) -> Payload = 0;
+
+      // libpq failed to send the statement
+      virtual void v_failed( const connection& /*unused*/, tracked& /*unused*/ ) {}
+
+      // called for each final result, t is nullptr for results that do not belong
+      // to a statement, e.g. a pipeline sync or the result after COPY
+      virtual void v_completed( const connection& c, const PGresult* result, tracked* t, const clock::time_point now ) = 0;
+
+   public:
+      statement_tracker( const statement_tracker& ) = delete;
+      statement_tracker( statement_tracker&& ) = delete;
+      void operator=( const statement_tracker& ) = delete;
+      void operator=( statement_tracker&& ) = delete;
+
+      // the hooks share the tracker, so the log handler may outlive the tracker's owner
+      static void install( pq::log& log, const std::shared_ptr< statement_tracker >& d )
+      {
+         log.connection.send_query = [ d ]( connection& c, const char* statement, const int n_params, const Oid* /*unused*/, const char* const* values, const int* lengths, const int* formats ) {
+            d->send( c, statement, n_params, values, lengths, formats );
+         };
+         log.connection.send_query.result = [ d ]( connection& c, const int result ) {
+            d->send_result( c, result );
+         };
+         log.connection.send_query_prepared = [ d ]( connection& c, const char* statement, const int n_params, const char* const* values, const int* lengths, const int* formats ) {
+            d->send( c, statement, n_params, values, lengths, formats );
+         };
+         log.connection.send_query_prepared.result = [ d ]( connection& c, const int result ) {
+            d->send_result( c, result );
+         };
+         log.connection.poll.result = [ d ]( connection& c, int /*unused*/, const poll::status status ) {
+            if( status == poll::status::readable ) {
+               d->readable( c );
+            }
+         };
+         log.connection.get_result = [ d ]( connection& c, clock::time_point /*unused*/ ) {
+            d->get_result( c );
+         };
+         log.connection.get_result.result = [ d ]( connection& c, PGresult* result ) {
+            d->result( c, result );
+         };
+      }
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_TRACE_HPP
+#define TAO_PQ_INTERNAL_TRACE_HPP
+
+#include <memory>
+#include <utility>
+
+#include <tao/pq/log.hpp>
+#include <tao/pq/trace.hpp>
+
+// the tracing policy is selected when the library is built,
+// see the TAOPQ_TRACE_POLICY and TAOPQ_TRACE_POLICY_HEADER cmake options.
+#if defined( TAO_PQ_TRACE_POLICY_HEADER )
+#include TAO_PQ_TRACE_POLICY_HEADER
+#endif
+
+namespace tao::pq::internal
+{
+#if defined( TAO_PQ_TRACE_POLICY )
+   using trace_policy = TAO_PQ_TRACE_POLICY;
+#else
+   using trace_policy = runtime_trace;
+#endif
+
+   template< trace_point P >
+   [[nodiscard]] auto trace_active( const std::shared_ptr< log >& log ) noexcept -> bool
+   {
+      return trace_policy::template active< P >( log );
+   }
+
+   template< trace_point P, typename... Ts >
+   void trace( const std::shared_ptr< log >& log, Ts&&... ts )
+   {
+      trace_policy::template call< P >( log, std::forward< Ts >( ts )... );
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
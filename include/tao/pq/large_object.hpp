@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <ios>
 #include <memory>
 #include <string>
@@ -17,6 +18,7 @@
 
 namespace tao::pq
 {
+   class pipeline;
    class transaction;
 
    class large_object final
@@ -25,7 +27,11 @@ namespace tao::pq
       std::shared_ptr< transaction > m_transaction;
       int m_fd;
 
+      static void abort_pipeline( const std::shared_ptr< transaction >& transaction, pipeline& pipeline, const bool synced ) noexcept;
+
    public:
+      static constexpr std::size_t default_chunk_size = 4 * 1024 * 1024;
+
       [[nodiscard]] static auto create( const std::shared_ptr< transaction >& transaction, const oid desired_id = oid::invalid ) -> oid;
 
       static void remove( const std::shared_ptr< transaction >& transaction, const oid id );
@@ -33,6 +39,11 @@ namespace tao::pq
       [[nodiscard]] static auto import_file( const std::shared_ptr< transaction >& transaction, const char* filename, const oid desired_id = oid::invalid ) -> oid;
       static void export_file( const std::shared_ptr< transaction >& transaction, const oid id, const char* filename );
 
+      // transfers the file in large chunks with pipelined lowrite()/loread() calls,
+      // several chunks are in flight at the same time. the connection's timeout applies per chunk.
+      [[nodiscard]] static auto import_file( const std::shared_ptr< transaction >& transaction, const std::filesystem::path& path, const std::size_t chunk_size, const oid desired_id = oid::invalid ) -> oid;
+      static void export_file( const std::shared_ptr< transaction >& transaction, const oid id, const std::filesystem::path& path, const std::size_t chunk_size );
+
       large_object( const std::shared_ptr< transaction >& transaction, const oid id, const std::ios_base::openmode m );
 
       large_object( const large_object& ) = delete;
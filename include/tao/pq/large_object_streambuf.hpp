@@ -0,0 +1,127 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_LARGE_OBJECT_STREAMBUF_HPP
+#define TAO_PQ_LARGE_OBJECT_STREAMBUF_HPP
+
+#include <cstddef>
+#include <ios>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <utility>
+
+#include <tao/pq/large_object.hpp>
+#include <tao/pq/oid.hpp>
+
+namespace tao::pq
+{
+   class transaction;
+
+   // buffers reads and writes of a large object, each buffer is filled
+   // with a single lo_read() and written with a single lo_write().
+   class large_object_streambuf final
+      : public std::streambuf
+   {
+   public:
+      static constexpr std::size_t default_buffer_size = 1024 * 1024;
+
+   private:
+      large_object m_large_object;
+      std::size_t m_buffer_size;
+      std::string m_get;  // allocated on first use
+      std::string m_put;  // allocated on first use
+      bool m_open = true;
+
+      void write_buffer();
+      void discard_read_ahead();
+
+   protected:
+      auto underflow() -> int_type override;
+      auto overflow( int_type c ) -> int_type override;
+      auto xsputn( const char_type* s, std::streamsize n ) -> std::streamsize override;
+      auto sync() -> int override;
+
+      auto seekoff( off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which ) -> pos_type override;
+      auto seekpos( pos_type pos, std::ios_base::openmode which ) -> pos_type override;
+
+   public:
+      explicit large_object_streambuf( large_object&& object, const std::size_t buffer_size = default_buffer_size );
+      large_object_streambuf( const std::shared_ptr< transaction >& transaction, const oid id, const std::ios_base::openmode m, const std::size_t buffer_size = default_buffer_size );
+
+      large_object_streambuf( const large_object_streambuf& ) = delete;
+      large_object_streambuf( large_object_streambuf&& ) = delete;
+
+      ~large_object_streambuf() override;
+
+      void operator=( const large_object_streambuf& ) = delete;
+      void operator=( large_object_streambuf&& ) = delete;
+
+      [[nodiscard]] auto buffer_size() const noexcept -> std::size_t
+      {
+         return m_buffer_size;
+      }
+
+      // writes pending data and closes the large object, errors are reported as exceptions
+      void close();
+   };
+
+   class large_object_istream final
+      : public std::istream
+   {
+   private:
+      large_object_streambuf m_buffer;
+
+   public:
+      template< typename... As >
+      explicit large_object_istream( As&&... as )
+         : std::istream( nullptr ),
+           m_buffer( std::forward< As >( as )... )
+      {
+         rdbuf( &m_buffer );
+      }
+
+      [[nodiscard]] auto buffer() noexcept -> large_object_streambuf&
+      {
+         return m_buffer;
+      }
+
+      void close()
+      {
+         m_buffer.close();
+      }
+   };
+
+   class large_object_ostream final
+      : public std::ostream
+   {
+   private:
+      large_object_streambuf m_buffer;
+
+   public:
+      template< typename... As >
+      explicit large_object_ostream( As&&... as )
+         : std::ostream( nullptr ),
+           m_buffer( std::forward< As >( as )... )
+      {
+         rdbuf( &m_buffer );
+      }
+
+      [[nodiscard]] auto buffer() noexcept -> large_object_streambuf&
+      {
+         return m_buffer;
+      }
+
+      // writes pending data and closes the large object, errors are reported as exceptions
+      void close()
+      {
+         m_buffer.close();
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
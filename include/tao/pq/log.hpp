@@ -6,7 +6,9 @@
 #define TAO_PQ_LOG_HPP
 
 #include <chrono>
+#include <cstddef>
 #include <functional>
+#include <memory>
 
 #include <libpq-fe.h>
 
@@ -15,13 +17,28 @@
 namespace tao::pq
 {
    class connection;
+   class connection_pool;
    class transaction;
 
    struct log
    {
       struct connection_pool_t
       {
-         // TODO...
+         // duration includes creating a new connection if no idle connection was available
+         using acquire_t = std::function< void( const connection_pool&, connection&, std::chrono::steady_clock::duration duration ) >;
+         using create_t = std::function< void( const connection_pool&, connection&, std::chrono::steady_clock::duration duration ) >;
+
+         using release_t = std::function< void( const connection_pool&, connection& ) >;  // noexcept
+         using discard_t = std::function< void( const connection_pool&, connection& ) >;  // noexcept
+
+         // called after each of the above events
+         using counts_t = std::function< void( const connection_pool&, std::size_t idle, std::size_t attached ) >;  // noexcept
+
+         acquire_t acquire;
+         create_t create;
+         release_t release;
+         discard_t discard;
+         counts_t counts;
 
       } connection_pool;
 
@@ -129,6 +146,11 @@ namespace tao::pq
       } transaction;
    };
 
+   // returns a log handler that calls the hooks of first and then those of second,
+   // only hooks that are set in either of them when chaining are set in the result.
+   // either argument may be nullptr, in which case the other one is returned.
+   [[nodiscard]] auto chain( const std::shared_ptr< log >& first, const std::shared_ptr< log >& second ) -> std::shared_ptr< log >;
+
 }  // namespace tao::pq
 
 #endif
@@ -0,0 +1,307 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_MD_ARRAY_HPP
+#define TAO_PQ_MD_ARRAY_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+#if defined( __cpp_lib_mdspan )
+#include <mdspan>
+#endif
+
+#include <tao/pq/result_traits.hpp>
+#include <tao/pq/result_traits_array.hpp>
+
+namespace tao::pq
+{
+   // a multi-dimensional array with contiguous storage in row-major order,
+   // which is the order PostgreSQL uses for its arrays
+
+   template< typename T >
+   class md_array
+   {
+   public:
+      static constexpr std::size_t max_rank = internal::binary_array_reader::max_dimensions;
+
+      using value_type = T;
+      using const_reference = typename std::vector< T >::const_reference;
+      using const_iterator = typename std::vector< T >::const_iterator;
+
+   private:
+      std::vector< T > m_data;
+      std::size_t m_rank = 0;
+      std::size_t m_extents[ max_rank ] = {};
+      std::size_t m_strides[ max_rank ] = {};
+
+      template< std::size_t N >
+      [[nodiscard]] auto offset( const std::size_t ( &indices )[ N ] ) const noexcept -> std::size_t
+      {
+         std::size_t result = 0;
+         for( std::size_t i = 0; i != N; ++i ) {
+            result += indices[ i ] * m_strides[ i ];
+         }
+         return result;
+      }
+
+   public:
+      md_array() = default;
+
+      md_array( std::vector< T > data, const std::span< const std::size_t > extents )
+         : m_data( std::move( data ) ),
+           m_rank( extents.size() )
+      {
+         if( m_rank > max_rank ) {
+            throw std::invalid_argument( "too many array dimensions" );
+         }
+         std::size_t size = ( m_rank == 0 ) ? 0 : 1;
+         for( std::size_t i = m_rank; i != 0; --i ) {
+            m_extents[ i - 1 ] = extents[ i - 1 ];
+            m_strides[ i - 1 ] = size;
+            size *= extents[ i - 1 ];
+         }
+         if( size != m_data.size() ) {
+            throw std::invalid_argument( "array dimensions do not match the number of elements" );
+         }
+      }
+
+      md_array( std::vector< T > data, const std::initializer_list< std::size_t > extents )
+         : md_array( std::move( data ), std::span< const std::size_t >( extents.begin(), extents.size() ) )
+      {}
+
+      [[nodiscard]] auto rank() const noexcept -> std::size_t
+      {
+         return m_rank;
+      }
+
+      [[nodiscard]] auto extent( const std::size_t dimension ) const noexcept -> std::size_t
+      {
+         assert( dimension < m_rank );
+         return m_extents[ dimension ];
+      }
+
+      // in elements, not bytes
+      [[nodiscard]] auto stride( const std::size_t dimension ) const noexcept -> std::size_t
+      {
+         assert( dimension < m_rank );
+         return m_strides[ dimension ];
+      }
+
+      [[nodiscard]] auto extents() const noexcept -> std::span< const std::size_t >
+      {
+         return { m_extents, m_rank };
+      }
+
+      [[nodiscard]] auto strides() const noexcept -> std::span< const std::size_t >
+      {
+         return { m_strides, m_rank };
+      }
+
+      [[nodiscard]] auto empty() const noexcept -> bool
+      {
+         return m_data.empty();
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      {
+         return m_data.size();
+      }
+
+      [[nodiscard]] auto data() const noexcept -> const T*
+      {
+         return m_data.data();
+      }
+
+      [[nodiscard]] auto values() const noexcept -> std::span< const T >
+      {
+         return m_data;
+      }
+
+      [[nodiscard]] auto begin() const noexcept -> const_iterator
+      {
+         return m_data.begin();
+      }
+
+      [[nodiscard]] auto end() const noexcept -> const_iterator
+      {
+         return m_data.end();
+      }
+
+      template< typename... Is >
+         requires( ( sizeof...( Is ) >= 1 ) && ( sizeof...( Is ) <= max_rank ) && ( std::is_convertible_v< Is, std::size_t > && ... ) )
+      [[nodiscard]] auto operator()( const Is... is ) const noexcept -> const_reference
+      {
+         assert( sizeof...( Is ) == m_rank );
+         return m_data[ md_array::offset( { static_cast< std::size_t >( is )... } ) ];
+      }
+
+      template< typename... Is >
+         requires( ( sizeof...( Is ) >= 1 ) && ( sizeof...( Is ) <= max_rank ) && ( std::is_convertible_v< Is, std::size_t > && ... ) )
+      [[nodiscard]] auto at( const Is... is ) const -> const_reference
+      {
+         if( sizeof...( Is ) != m_rank ) {
+            throw std::out_of_range( "wrong number of array indices" );
+         }
+         const std::size_t indices[] = { static_cast< std::size_t >( is )... };
+         for( std::size_t i = 0; i != sizeof...( Is ); ++i ) {
+            if( indices[ i ] >= m_extents[ i ] ) {
+               throw std::out_of_range( "array index out of range" );
+            }
+         }
+         return m_data[ md_array::offset( indices ) ];
+      }
+
+#if defined( __cpp_lib_mdspan )
+      template< std::size_t Rank >
+      [[nodiscard]] auto to_mdspan() const -> std::mdspan< const T, std::dextents< std::size_t, Rank > >
+      {
+         if( Rank != m_rank ) {
+            throw std::invalid_argument( "array rank mismatch" );
+         }
+         return [ this ]< std::size_t... Ns >( std::index_sequence< Ns... > /*unused*/ ) {
+            return std::mdspan< const T, std::dextents< std::size_t, Rank > >( m_data.data(), m_extents[ Ns ]... );
+         }( std::make_index_sequence< Rank >() );
+      }
+#endif
+
+      [[nodiscard]] friend auto operator==( const md_array& lhs, const md_array& rhs ) -> bool
+      {
+         return std::ranges::equal( lhs.extents(), rhs.extents() ) && ( lhs.m_data == rhs.m_data );
+      }
+   };
+
+   namespace internal
+   {
+      template< typename T >
+      void parse_md_array( const char*& value, std::vector< T >& data, std::size_t* extents, const std::size_t rank, const std::size_t dimension )
+      {
+         if( *value++ != '{' ) {
+            throw std::invalid_argument( "expected '{'" );
+         }
+         std::size_t n = 0;
+         while( true ) {
+            if( dimension + 1 < rank ) {
+               internal::parse_md_array( value, data, extents, rank, dimension + 1 );
+            }
+            else {
+               data.push_back( internal::parse< T >( value ) );
+            }
+            ++n;
+            switch( *value++ ) {
+               case ',':
+               case ';':
+                  break;
+
+               case '}':
+                  if( extents[ dimension ] == 0 ) {
+                     extents[ dimension ] = n;
+                  }
+                  else if( extents[ dimension ] != n ) {
+                     throw std::invalid_argument( "multidimensional arrays must have sub-arrays with matching dimensions" );
+                  }
+                  return;
+
+               default:
+                  throw std::invalid_argument( "expected ',', ';', or '}'" );
+            }
+         }
+      }
+
+   }  // namespace internal
+
+   template< typename T >
+      requires result_type_direct< T >
+   struct result_traits< md_array< T > >
+   {
+      static auto from( const char* value ) -> md_array< T >
+      {
+         // skip optional dimension decoration, e.g. '[0:1]={...}'
+         if( *value == '[' ) {
+            while( ( *value != '\0' ) && ( *value != '=' ) ) {
+               ++value;
+            }
+            if( *value++ != '=' ) {
+               throw std::invalid_argument( "invalid array dimension decoration" );
+            }
+         }
+
+         std::size_t rank = 0;
+         while( value[ rank ] == '{' ) {
+            ++rank;
+         }
+         if( ( rank == 1 ) && ( value[ 1 ] == '}' ) ) {
+            if( value[ 2 ] != '\0' ) {
+               throw std::invalid_argument( "unexpected additional data" );
+            }
+            return md_array< T >();
+         }
+         if( rank == 0 ) {
+            throw std::invalid_argument( "expected '{'" );
+         }
+         if( rank > md_array< T >::max_rank ) {
+            throw std::invalid_argument( "too many array dimensions" );
+         }
+
+         std::vector< T > data;
+         std::size_t extents[ md_array< T >::max_rank ] = {};
+         internal::parse_md_array( value, data, extents, rank, 0 );
+         if( *value != '\0' ) {
+            throw std::invalid_argument( "unexpected additional data" );
+         }
+         return md_array< T >( std::move( data ), std::span< const std::size_t >( extents, rank ) );
+      }
+
+      static auto from_binary( const char* value, const std::size_t size ) -> md_array< T >
+         requires result_type_binary< T >
+      {
+         internal::binary_array_reader reader( value, size );
+         if( reader.dimensions() == 0 ) {
+            return md_array< T >();
+         }
+
+         // each element takes at least four bytes for its length, checked before each multiplication to prevent an overflow
+         const std::size_t limit = reader.remaining() / 4;
+         std::size_t extents[ md_array< T >::max_rank ];
+         std::size_t n = 1;
+         for( std::size_t i = 0; i != reader.dimensions(); ++i ) {
+            extents[ i ] = reader.size( i );
+            if( ( extents[ i ] != 0 ) && ( n > limit / extents[ i ] ) ) {
+               throw std::invalid_argument( "unexpected end of binary array" );
+            }
+            n *= extents[ i ];
+         }
+
+         const std::span< const std::size_t > dimensions( extents, reader.dimensions() );
+         std::vector< T > data;
+         // std::vector< bool > has no contiguous storage to decode into
+         if constexpr( std::is_arithmetic_v< T > && requires { data.data(); } ) {
+            if( !reader.has_null() && internal::is_fixed_width_element< T >( reader.element() ) ) {
+               data.resize( n );
+               reader.next_n( data.data(), n );
+               reader.finish();
+               return md_array< T >( std::move( data ), dimensions );
+            }
+         }
+         data.reserve( n );
+         for( std::size_t i = 0; i != n; ++i ) {
+            data.push_back( internal::parse_binary< T >( reader, 0 ) );
+         }
+         reader.finish();
+         return md_array< T >( std::move( data ), dimensions );
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,155 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_METRICS_HPP
+#define TAO_PQ_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/internal/chained_log.hpp>
+
+namespace tao::pq
+{
+   namespace internal
+   {
+      struct metrics_data;
+
+   }  // namespace internal
+
+   // log-linear histogram of durations in nanoseconds, the relative error of
+   // the recorded values is at most 1/16, durations above max_value (~137s) are clamped.
+   class latency_histogram final
+   {
+   public:
+      static constexpr std::size_t sub_buckets = 16;
+      static constexpr std::size_t max_shift = 32;
+      static constexpr std::size_t buckets = ( max_shift + 2 ) * sub_buckets;
+      static constexpr std::uint64_t max_value = ( std::uint64_t( 2 * sub_buckets ) << max_shift ) - 1;
+
+      [[nodiscard]] static constexpr auto index( std::uint64_t ns ) noexcept -> std::size_t
+      {
+         if( ns > max_value ) {
+            ns = max_value;
+         }
+         if( ns < sub_buckets ) {
+            return static_cast< std::size_t >( ns );
+         }
+         const auto shift = static_cast< std::size_t >( std::bit_width( ns ) - std::bit_width( sub_buckets ) );
+         return ( ( shift + 1 ) * sub_buckets ) + static_cast< std::size_t >( ( ns >> shift ) - sub_buckets );
+      }
+
+      // the highest value that is recorded in the bucket with the given index
+      [[nodiscard]] static constexpr auto upper_bound( const std::size_t index ) noexcept -> std::uint64_t
+      {
+         if( index < sub_buckets ) {
+            return index;
+         }
+         const auto shift = ( index / sub_buckets ) - 1;
+         return ( ( ( index % sub_buckets ) + sub_buckets + 1 ) << shift ) - 1;
+      }
+
+      class snapshot
+      {
+      private:
+         friend class latency_histogram;
+
+         std::vector< std::pair< std::size_t, std::uint64_t > > m_counts;  // only the non-empty buckets, by index
+         std::uint64_t m_count = 0;
+         std::uint64_t m_sum = 0;
+         std::uint64_t m_max = 0;
+
+      public:
+         [[nodiscard]] auto count() const noexcept -> std::uint64_t
+         {
+            return m_count;
+         }
+
+         [[nodiscard]] auto sum() const noexcept -> std::chrono::nanoseconds
+         {
+            return std::chrono::nanoseconds( m_sum );
+         }
+
+         [[nodiscard]] auto mean() const noexcept -> std::chrono::nanoseconds
+         {
+            return std::chrono::nanoseconds( ( m_count == 0 ) ? 0 : ( m_sum / m_count ) );
+         }
+
+         [[nodiscard]] auto max() const noexcept -> std::chrono::nanoseconds
+         {
+            return std::chrono::nanoseconds( m_max );
+         }
+
+         // percentile in [0,100], e.g. 99.9
+         [[nodiscard]] auto percentile( const double p ) const noexcept -> std::chrono::nanoseconds;
+
+         // the non-empty buckets as pairs of upper bound and count
+         [[nodiscard]] auto buckets() const -> std::vector< std::pair< std::chrono::nanoseconds, std::uint64_t > >;
+      };
+
+   private:
+      std::array< std::atomic< std::uint64_t >, buckets > m_counts = {};
+      std::atomic< std::uint64_t > m_sum = 0;
+      std::atomic< std::uint64_t > m_max = 0;
+
+   public:
+      void record( const std::chrono::nanoseconds duration ) noexcept;
+
+      [[nodiscard]] auto get_snapshot() const -> snapshot;
+
+      void reset() noexcept;
+   };
+
+   // collects latencies of all statements executed on connections that use its log handler
+   class metrics final
+      : public internal::chained_log
+   {
+   public:
+      // each statement takes about 17 KB for its four histograms, about 17 MB for the default
+      static constexpr std::size_t default_max_statements = 1000;
+
+      // statements that exceed the maximum number of statements are recorded under this name
+      static constexpr const char* other_statements = "<other>";
+
+      struct statement_snapshot
+      {
+         std::string statement;  // the SQL or the name of the prepared statement
+         std::uint64_t count = 0;
+         std::uint64_t errors = 0;
+
+         latency_histogram::snapshot send;    // passing the statement to libpq
+         latency_histogram::snapshot wait;    // until the result starts arriving
+         latency_histogram::snapshot decode;  // until libpq has built the result
+         latency_histogram::snapshot total;
+      };
+
+   private:
+      std::shared_ptr< internal::metrics_data > m_data;
+
+   public:
+      explicit metrics( const std::size_t max_statements = default_max_statements );
+
+      metrics( const metrics& ) = delete;
+      metrics( metrics&& ) = delete;
+      void operator=( const metrics& ) = delete;
+      void operator=( metrics&& ) = delete;
+
+      ~metrics() = default;
+
+      [[nodiscard]] auto snapshot() const -> std::vector< statement_snapshot >;
+
+      void reset();
+   };
+
+}  // namespace tao::pq
+
+#endif
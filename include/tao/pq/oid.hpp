@@ -14,8 +14,30 @@ namespace tao::pq
    enum class oid : Oid  // NOLINT(performance-enum-size)
    {
       invalid = 0,
+      boolean = 16,
       bytea = 17,
-      text = 25
+      character = 18,  // "char", a single byte
+      name = 19,
+      int8 = 20,
+      int2 = 21,
+      int4 = 23,
+      text = 25,
+      json = 114,
+      xml = 142,
+      float4 = 700,
+      float8 = 701,
+      unknown = 705,
+      boolean_array = 1000,
+      bytea_array = 1001,
+      int2_array = 1005,
+      int4_array = 1007,
+      text_array = 1009,
+      int8_array = 1016,
+      float4_array = 1021,
+      float8_array = 1022,
+      bpchar = 1042,
+      varchar = 1043,
+      first_user_defined = 16384
    };
 
 }  // namespace tao::pq
@@ -0,0 +1,130 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_PARALLEL_TABLE_WRITER_HPP
+#define TAO_PQ_PARALLEL_TABLE_WRITER_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/commit_mode.hpp>
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/exception.hpp>
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/parameter.hpp>
+#include <tao/pq/table_writer.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   // thrown when prepared transactions could not be committed, they remain on the server
+   // and must be resolved manually with COMMIT PREPARED, see pg_prepared_xacts
+   struct prepared_commit_error
+      : error
+   {
+      std::vector< std::string > gids;
+
+      prepared_commit_error( const std::string& what, std::vector< std::string >&& in_gids )
+         : error( what ),
+           gids( std::move( in_gids ) )
+      {}
+   };
+
+   // thrown when an independent commit fails after some transactions were already committed,
+   // the remaining transactions are rolled back
+   struct partial_commit_error
+      : error
+   {
+      std::vector< std::size_t > shards;  // the indices of the committed shards
+      std::size_t rows;                   // committed by these shards
+
+      partial_commit_error( const std::string& what, std::vector< std::size_t >&& in_shards, const std::size_t in_rows )
+         : error( what ),
+           shards( std::move( in_shards ) ),
+           rows( in_rows )
+      {}
+   };
+
+   // distributes rows over several connections, each running its own COPY in its own transaction
+   class parallel_table_writer final
+   {
+   private:
+      struct shard_data
+      {
+         std::shared_ptr< pq::connection > connection;
+         std::shared_ptr< pq::transaction > transaction;
+         std::unique_ptr< table_writer > writer;
+         std::string gid;       // set once the transaction is prepared
+         std::size_t rows = 0;  // set once the COPY is finished
+      };
+
+      const std::shared_ptr< connection_pool > m_pool;
+      std::vector< shard_data > m_shards;
+      const pq::commit_mode m_commit_mode;
+      std::size_t m_next = 0;
+
+      void rollback() noexcept;
+      [[nodiscard]] auto commit_prepared( shard_data& s ) noexcept -> bool;
+
+   public:
+      parallel_table_writer( const std::shared_ptr< connection_pool >& pool, const std::size_t connections, const internal::zsv statement, const pq::commit_mode cm = pq::commit_mode::independent );
+
+      ~parallel_table_writer();
+
+      parallel_table_writer( const parallel_table_writer& ) = delete;
+      parallel_table_writer( parallel_table_writer&& ) = delete;
+      void operator=( const parallel_table_writer& ) = delete;
+      void operator=( parallel_table_writer&& ) = delete;
+
+      [[nodiscard]] auto shards() const noexcept -> std::size_t
+      {
+         return m_shards.size();
+      }
+
+      [[nodiscard]] auto commit_mode() const noexcept -> pq::commit_mode
+      {
+         return m_commit_mode;
+      }
+
+      // for custom sharding, e.g. by key
+      [[nodiscard]] auto shard( const std::size_t index ) -> table_writer&;
+
+      [[nodiscard]] auto is_binary() const noexcept -> bool
+      {
+         assert( !m_shards.empty() );
+         return m_shards.front().writer->is_binary();
+      }
+
+      void set_flush_threshold( const std::size_t threshold );
+
+      // round-robin, data must consist of complete rows
+      void insert_raw( const std::string_view data );
+
+      // round-robin
+      template< parameter_type... As >
+         requires( sizeof...( As ) >= 1 )
+      void insert( As&&... as )
+      {
+         auto& writer = shard( m_next );
+         writer.insert( std::forward< As >( as )... );
+         m_next = ( m_next + 1 ) % m_shards.size();
+      }
+
+      void flush();
+
+      // returns the total number of rows, throws partial_commit_error if an independent
+      // commit fails after other shards were committed, or prepared_commit_error
+      // if two-phase commit fails after all transactions were prepared
+      auto commit() -> std::size_t;
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -6,19 +6,26 @@
 #define TAO_PQ_PARAMETER_TRAITS_HPP
 
 #include <cassert>
+#include <charconv>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <iterator>
+#include <limits>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 #include <tao/pq/binary.hpp>
 #include <tao/pq/bind.hpp>
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/parameter_traits_helper.hpp>
 #include <tao/pq/internal/resize_uninitialized.hpp>
 #include <tao/pq/null.hpp>
@@ -69,6 +76,110 @@ namespace tao::pq
          { t.template element< 0 >( s ) } -> std::same_as< void >;
       };
 
+      template< typename T, std::size_t... Is >
+      [[nodiscard]] consteval auto parameter_type_has_copy_to_binary( std::index_sequence< Is... > /*unused*/ ) noexcept -> bool
+      {
+         return ( requires( const parameter_traits< T >& t, std::string& s ) { t.template copy_to_binary< Is >( s ); } && ... );
+      }
+
+      // helpers for binary COPY, see PostgreSQL's CopySendInt32()
+      inline void copy_to_binary_append( std::string& data, const void* p, const std::size_t size )
+      {
+         if( size > static_cast< std::size_t >( std::numeric_limits< std::int32_t >::max() ) ) {
+            throw std::length_error( "value too large for binary COPY" );
+         }
+         internal::append_big_endian( data, static_cast< std::int32_t >( size ) );
+         data.append( static_cast< const char* >( p ), size );
+      }
+
+      inline void copy_to_binary_null( std::string& data )
+      {
+         internal::append_big_endian( data, std::int32_t( -1 ) );
+      }
+
+      // the text representation is only generated when needed,
+      // therefore binary COPY does not pay for it
+      template< typename T >
+      struct arithmetic_helper
+      {
+      protected:
+         const T m_v;
+         mutable char m_buffer[ 32 ];
+
+         static void to_text( char ( &buffer )[ 32 ], const T v ) noexcept
+         {
+            if constexpr( std::is_integral_v< T > ) {
+               const auto [ ptr, ec ] = std::to_chars( std::begin( buffer ), std::end( buffer ), v );
+               assert( ec == std::errc() );
+               *ptr = '\0';
+            }
+            else if constexpr( std::is_same_v< T, float > ) {
+               internal::snprintf( buffer, "%.9g", v );
+            }
+            else {
+               static_assert( std::is_same_v< T, double > );
+               internal::snprintf( buffer, "%.17g", v );
+            }
+         }
+
+      public:
+         explicit arithmetic_helper( const T v ) noexcept
+            : m_v( v )
+         {}
+
+         static constexpr std::size_t columns = 1;
+         static constexpr bool self_contained = true;
+
+         template< std::size_t I >
+         [[nodiscard]] static constexpr auto type() noexcept -> oid
+         {
+            return oid::invalid;
+         }
+
+         template< std::size_t I >
+         [[nodiscard]] auto value() const noexcept -> const char*
+         {
+            arithmetic_helper::to_text( m_buffer, m_v );
+            return m_buffer;
+         }
+
+         template< std::size_t I >
+         [[nodiscard]] static constexpr auto length() noexcept -> int
+         {
+            return 0;
+         }
+
+         template< std::size_t I >
+         [[nodiscard]] static constexpr auto format() noexcept -> int
+         {
+            return 0;
+         }
+
+         template< std::size_t I >
+         void element( std::string& data ) const
+         {
+            char buffer[ 32 ];
+            arithmetic_helper::to_text( buffer, m_v );
+            data += buffer;
+         }
+
+         template< std::size_t I >
+         void copy_to( std::string& data ) const
+         {
+            char buffer[ 32 ];
+            arithmetic_helper::to_text( buffer, m_v );
+            data += buffer;
+         }
+
+         // int2, int4, int8, float4, float8
+         template< std::size_t I >
+         void copy_to_binary( std::string& data ) const
+         {
+            internal::append_big_endian( data, static_cast< std::int32_t >( sizeof( T ) ) );
+            internal::append_big_endian( data, m_v );
+         }
+      };
+
    }  // namespace internal
 
    template< typename T >
@@ -82,6 +193,9 @@ namespace tao::pq
       { t.template copy_to< 0 >( s ) } -> std::same_as< void >;
    } && ( ( parameter_traits< std::decay_t< T > >::columns >= 2 ) || internal::parameter_type_has_element< T > );
 
+   template< typename T >
+   concept parameter_type_binary = parameter_type_direct< T > && internal::parameter_type_has_copy_to_binary< std::decay_t< T > >( std::make_index_sequence< parameter_traits< std::decay_t< T > >::columns >() );
+
    template<>
    struct parameter_traits< null_t >
    {
@@ -126,6 +240,12 @@ namespace tao::pq
       {
          data += "\\N";
       }
+
+      template< std::size_t I >
+      static void copy_to_binary( std::string& data )
+      {
+         internal::copy_to_binary_null( data );
+      }
    };
 
    template<>
@@ -149,6 +269,13 @@ namespace tao::pq
       {
          data += m_p;
       }
+
+      template< std::size_t I >
+      void copy_to_binary( std::string& data ) const
+      {
+         const char v = ( *m_p == 'T' ) ? 1 : 0;
+         internal::copy_to_binary_append( data, &v, 1 );
+      }
    };
 
    template<>
@@ -198,6 +325,12 @@ namespace tao::pq
       {
          internal::table_writer_append( data, std::string_view( m_value, 1 ) );
       }
+
+      template< std::size_t I >
+      void copy_to_binary( std::string& data ) const
+      {
+         internal::copy_to_binary_append( data, m_value, 1 );
+      }
    };
 
    template<>
@@ -216,9 +349,9 @@ namespace tao::pq
 
    template<>
    struct parameter_traits< short >
-      : internal::to_chars_helper
+      : internal::arithmetic_helper< short >
    {
-      using internal::to_chars_helper::to_chars_helper;
+      using internal::arithmetic_helper< short >::arithmetic_helper;
    };
 
    template<>
@@ -230,9 +363,9 @@ namespace tao::pq
 
    template<>
    struct parameter_traits< int >
-      : internal::to_chars_helper
+      : internal::arithmetic_helper< int >
    {
-      using internal::to_chars_helper::to_chars_helper;
+      using internal::arithmetic_helper< int >::arithmetic_helper;
    };
 
    template<>
@@ -244,9 +377,9 @@ namespace tao::pq
 
    template<>
    struct parameter_traits< long >
-      : internal::to_chars_helper
+      : internal::arithmetic_helper< long >
    {
-      using internal::to_chars_helper::to_chars_helper;
+      using internal::arithmetic_helper< long >::arithmetic_helper;
    };
 
    template<>
@@ -258,9 +391,9 @@ namespace tao::pq
 
    template<>
    struct parameter_traits< long long >
-      : internal::to_chars_helper
+      : internal::arithmetic_helper< long long >
    {
-      using internal::to_chars_helper::to_chars_helper;
+      using internal::arithmetic_helper< long long >::arithmetic_helper;
    };
 
    template<>
@@ -272,22 +405,16 @@ namespace tao::pq
 
    template<>
    struct parameter_traits< float >
-      : internal::buffer_helper
+      : internal::arithmetic_helper< float >
    {
-      explicit parameter_traits( const float v ) noexcept
-      {
-         internal::snprintf( m_buffer, "%.9g", v );
-      }
+      using internal::arithmetic_helper< float >::arithmetic_helper;
    };
 
    template<>
    struct parameter_traits< double >
-      : internal::buffer_helper
+      : internal::arithmetic_helper< double >
    {
-      explicit parameter_traits( const double v ) noexcept
-      {
-         internal::snprintf( m_buffer, "%.17g", v );
-      }
+      using internal::arithmetic_helper< double >::arithmetic_helper;
    };
 
    template<>
@@ -317,6 +444,12 @@ namespace tao::pq
       {
          internal::table_writer_append( data, m_p );
       }
+
+      template< std::size_t I >
+      void copy_to_binary( std::string& data ) const
+      {
+         internal::copy_to_binary_append( data, m_p, std::strlen( m_p ) );
+      }
    };
 
    // for string_views (which are not zero-terminated) we can use binary format and,
@@ -371,6 +504,12 @@ namespace tao::pq
       {
          internal::table_writer_append( data, m_v );
       }
+
+      template< std::size_t I >
+      void copy_to_binary( std::string& data ) const
+      {
+         internal::copy_to_binary_append( data, m_v.data(), m_v.size() );
+      }
    };
 
    template<>
@@ -439,6 +578,12 @@ namespace tao::pq
       {
          element< I >( data );
       }
+
+      template< std::size_t I >
+      void copy_to_binary( std::string& data ) const
+      {
+         internal::copy_to_binary_append( data, m_v.data(), m_v.size() );
+      }
    };
 
    template< std::size_t Extent >
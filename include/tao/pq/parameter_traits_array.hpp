@@ -5,9 +5,20 @@
 #ifndef TAO_PQ_PARAMETER_TRAITS_ARRAY_HPP
 #define TAO_PQ_PARAMETER_TRAITS_ARRAY_HPP
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
+#include <tao/pq/binary.hpp>
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/internal/resize_uninitialized.hpp>
 #include <tao/pq/is_array.hpp>
 #include <tao/pq/oid.hpp>
 #include <tao/pq/parameter_traits.hpp>
@@ -42,6 +53,247 @@ namespace tao::pq
          }
       }
 
+      // binary format, see PostgreSQL's array_send()
+
+      template< typename T >
+      [[nodiscard]] consteval auto binary_integer_oid() noexcept -> oid
+      {
+         switch( sizeof( T ) ) {
+            case 2:
+               return oid::int2;
+            case 4:
+               return oid::int4;
+            case 8:
+               return oid::int8;
+            default:
+               return oid::invalid;
+         }
+      }
+
+      template< typename >
+      inline constexpr oid binary_array_element = oid::invalid;
+
+      template<>
+      inline constexpr oid binary_array_element< bool > = oid::boolean;
+
+      template<>
+      inline constexpr oid binary_array_element< short > = internal::binary_integer_oid< short >();
+
+      template<>
+      inline constexpr oid binary_array_element< int > = internal::binary_integer_oid< int >();
+
+      template<>
+      inline constexpr oid binary_array_element< long > = internal::binary_integer_oid< long >();
+
+      template<>
+      inline constexpr oid binary_array_element< long long > = internal::binary_integer_oid< long long >();
+
+      template<>
+      inline constexpr oid binary_array_element< float > = oid::float4;
+
+      template<>
+      inline constexpr oid binary_array_element< double > = oid::float8;
+
+      template<>
+      inline constexpr oid binary_array_element< std::string > = oid::text;
+
+      template<>
+      inline constexpr oid binary_array_element< std::string_view > = oid::text;
+
+      template<>
+      inline constexpr oid binary_array_element< binary > = oid::bytea;
+
+      template< typename T >
+      inline constexpr oid binary_array_element< std::optional< T > > = binary_array_element< T >;
+
+      [[nodiscard]] constexpr auto binary_array_type( const oid element ) noexcept -> oid
+      {
+         switch( element ) {
+            case oid::boolean:
+               return oid::boolean_array;
+            case oid::bytea:
+               return oid::bytea_array;
+            case oid::int2:
+               return oid::int2_array;
+            case oid::int4:
+               return oid::int4_array;
+            case oid::int8:
+               return oid::int8_array;
+            case oid::text:
+               return oid::text_array;
+            case oid::float4:
+               return oid::float4_array;
+            case oid::float8:
+               return oid::float8_array;
+            default:
+               return oid::invalid;
+         }
+      }
+
+      template< typename T >
+      struct array_leaf
+      {
+         using type = T;
+         static constexpr std::size_t dimensions = 0;
+      };
+
+      template< typename T >
+         requires pq::is_array_parameter< T >
+      struct array_leaf< T >
+      {
+         using type = typename array_leaf< typename T::value_type >::type;
+         static constexpr std::size_t dimensions = array_leaf< typename T::value_type >::dimensions + 1;
+      };
+
+      // arrays with a binary encoding, used by binary COPY
+      template< typename T >
+      concept binary_copy_array_parameter_type = array_parameter_type< T > && ( array_leaf< T >::dimensions <= 6 ) && ( binary_array_element< typename array_leaf< T >::type > != oid::invalid );
+
+      // arrays that are also bound in binary format, strings are bound untyped as text
+      template< typename T >
+      concept binary_array_parameter_type = binary_copy_array_parameter_type< T > && ( binary_array_element< typename array_leaf< T >::type > != oid::text );
+
+      template< typename T >
+      void binary_array_dimensions( std::int32_t* dimensions, const T& v )
+      {
+         if( v.size() > static_cast< std::size_t >( std::numeric_limits< std::int32_t >::max() ) ) {
+            throw std::length_error( "array too large" );
+         }
+         *dimensions = static_cast< std::int32_t >( v.size() );
+         if constexpr( pq::is_array_parameter< typename T::value_type > ) {
+            if( v.empty() ) {
+               std::fill_n( dimensions + 1, array_leaf< typename T::value_type >::dimensions, 0 );
+            }
+            else {
+               internal::binary_array_dimensions( dimensions + 1, *v.begin() );
+            }
+         }
+      }
+
+      template< typename T >
+      void binary_array_check( const std::int32_t* dimensions, const T& v )
+      {
+         if( v.size() != static_cast< std::size_t >( *dimensions ) ) {
+            throw std::invalid_argument( "multidimensional arrays must have sub-arrays with matching dimensions" );
+         }
+         if constexpr( pq::is_array_parameter< typename T::value_type > ) {
+            for( const auto& e : v ) {
+               internal::binary_array_check( dimensions + 1, e );
+            }
+         }
+      }
+
+      // fixed-width elements without NULLs, written into a pre-sized buffer
+
+      template< typename L, typename T >
+      void binary_array_write( char*& p, const T& v ) noexcept
+      {
+         for( const auto& e : v ) {
+            if constexpr( pq::is_array_parameter< typename T::value_type > ) {
+               internal::binary_array_write< L >( p, e );
+            }
+            else {
+               internal::to_big_endian( p, static_cast< std::int32_t >( sizeof( L ) ) );
+               internal::to_big_endian( p + 4, static_cast< L >( e ) );
+               p += 4 + sizeof( L );
+            }
+         }
+      }
+
+      template< typename T >
+         requires std::is_arithmetic_v< T >
+      void binary_array_append_element( std::string& data, bool& /*unused*/, const T v )
+      {
+         internal::append_big_endian( data, static_cast< std::int32_t >( sizeof( T ) ) );
+         internal::append_big_endian( data, v );
+      }
+
+      inline void binary_array_append_element( std::string& data, bool& /*unused*/, const void* p, const std::size_t size )
+      {
+         if( size > static_cast< std::size_t >( std::numeric_limits< std::int32_t >::max() ) ) {
+            throw std::length_error( "array element too large" );
+         }
+         internal::append_big_endian( data, static_cast< std::int32_t >( size ) );
+         data.append( static_cast< const char* >( p ), size );
+      }
+
+      inline void binary_array_append_element( std::string& data, bool& has_null, const std::string_view v )
+      {
+         internal::binary_array_append_element( data, has_null, v.data(), v.size() );
+      }
+
+      inline void binary_array_append_element( std::string& data, bool& has_null, const binary& v )
+      {
+         internal::binary_array_append_element( data, has_null, v.data(), v.size() );
+      }
+
+      template< typename T >
+      void binary_array_append_element( std::string& data, bool& has_null, const std::optional< T >& v )
+      {
+         if( v ) {
+            internal::binary_array_append_element( data, has_null, *v );
+         }
+         else {
+            internal::append_big_endian( data, std::int32_t( -1 ) );
+            has_null = true;
+         }
+      }
+
+      template< typename T >
+      void binary_array_append( std::string& data, bool& has_null, const T& v )
+      {
+         for( const auto& e : v ) {
+            if constexpr( pq::is_array_parameter< typename T::value_type > ) {
+               internal::binary_array_append( data, has_null, e );
+            }
+            else {
+               internal::binary_array_append_element( data, has_null, e );
+            }
+         }
+      }
+
+      template< typename T >
+      void to_binary_array( std::string& data, const T& v )
+      {
+         using leaf = array_leaf< T >;
+         using L = typename leaf::type;
+
+         std::int32_t dimensions[ leaf::dimensions ];
+         internal::binary_array_dimensions( dimensions, v );
+         internal::binary_array_check( dimensions, v );
+
+         std::size_t elements = 1;
+         for( const auto d : dimensions ) {
+            elements *= static_cast< std::size_t >( d );
+         }
+
+         const auto offset = data.size();
+         internal::append_big_endian( data, static_cast< std::int32_t >( ( elements == 0 ) ? 0 : leaf::dimensions ) );
+         internal::append_big_endian( data, std::int32_t( 0 ) );
+         internal::append_big_endian( data, static_cast< std::uint32_t >( binary_array_element< L > ) );
+         if( elements == 0 ) {
+            return;
+         }
+         for( const auto d : dimensions ) {
+            internal::append_big_endian( data, d );
+            internal::append_big_endian( data, std::int32_t( 1 ) );
+         }
+
+         if constexpr( std::is_arithmetic_v< L > ) {
+            const auto start = data.size();
+            internal::resize_uninitialized( data, start + elements * ( 4 + sizeof( L ) ) );
+            char* p = data.data() + start;
+            internal::binary_array_write< L >( p, v );
+         }
+         else {
+            bool has_null = false;
+            internal::binary_array_append( data, has_null, v );
+            if( has_null ) {
+               internal::to_big_endian( data.data() + offset + 4, std::int32_t( 1 ) );
+            }
+         }
+      }
+
    }  // namespace internal
 
    template< internal::array_parameter_type T >
@@ -96,6 +348,115 @@ namespace tao::pq
       }
    };
 
+   // arrays of fixed-width types and bytea are sent in binary format, arrays of
+   // strings are sent untyped in text format to let the server infer the element
+   // type (e.g. uuid[] or jsonb[]), but support binary COPY. each representation
+   // is only generated when it is needed.
+
+   template< internal::binary_copy_array_parameter_type T >
+   struct parameter_traits< T >
+   {
+   private:
+      using leaf = typename internal::array_leaf< T >::type;
+
+      static constexpr bool bind_binary = internal::binary_array_parameter_type< T >;
+
+      const T& m_v;
+      mutable std::string m_data;  // binary if bind_binary, text otherwise
+
+      [[nodiscard]] static auto to_binary( const T& v ) -> std::string
+      {
+         std::string data;
+         internal::to_binary_array( data, v );
+         if( data.size() > static_cast< std::size_t >( std::numeric_limits< int >::max() ) ) {
+            throw std::length_error( "array too large" );
+         }
+         return data;
+      }
+
+      [[nodiscard]] static auto to_text( const T& v ) -> std::string
+      {
+         std::string data;
+         internal::to_array( data, v );
+         return data;
+      }
+
+      // neither representation is ever empty
+      [[nodiscard]] auto data() const -> const std::string&
+      {
+         if( m_data.empty() ) {
+            m_data = bind_binary ? to_binary( m_v ) : to_text( m_v );
+         }
+         return m_data;
+      }
+
+   public:
+      explicit parameter_traits( const T& v ) noexcept
+         : m_v( v )
+      {}
+
+      static constexpr std::size_t columns = 1;
+      static constexpr bool self_contained = false;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> oid
+      {
+         return bind_binary ? internal::binary_array_type( internal::binary_array_element< leaf > ) : oid::invalid;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const -> const char*
+      {
+         return data().c_str();
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto length() const -> int
+      {
+         return bind_binary ? static_cast< int >( data().size() ) : 0;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return bind_binary ? 1 : 0;
+      }
+
+      template< std::size_t I >
+      void element( std::string& out ) const
+      {
+         if constexpr( bind_binary ) {
+            internal::array_append( out, to_text( m_v ) );
+         }
+         else {
+            internal::array_append( out, data() );
+         }
+      }
+
+      template< std::size_t I >
+      void copy_to( std::string& out ) const
+      {
+         if constexpr( bind_binary ) {
+            internal::table_writer_append( out, to_text( m_v ) );
+         }
+         else {
+            internal::table_writer_append( out, data() );
+         }
+      }
+
+      template< std::size_t I >
+      void copy_to_binary( std::string& out ) const
+      {
+         if constexpr( bind_binary ) {
+            internal::copy_to_binary_append( out, data().data(), data().size() );
+         }
+         else {
+            const auto encoded = to_binary( m_v );
+            internal::copy_to_binary_append( out, encoded.data(), encoded.size() );
+         }
+      }
+   };
+
 }  // namespace tao::pq
 
 #endif
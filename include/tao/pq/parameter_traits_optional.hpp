@@ -84,6 +84,18 @@ public:
          data += "\\N";
       }
    }
+
+   template< std::size_t I >
+      requires requires( const U& u, std::string& s ) { u.template copy_to_binary< I >( s ); }
+   void copy_to_binary( std::string& data ) const
+   {
+      if( m_forwarder ) {
+         m_forwarder->template copy_to_binary< I >( data );
+      }
+      else {
+         internal::copy_to_binary_null( data );
+      }
+   }
 };
 
 #endif
@@ -67,6 +67,12 @@ public:
    {
       std::get< gen::template outer< I > >( m_pair ).template copy_to< gen::template inner< I > >( data );
    }
+   template< std::size_t I >
+      requires requires( const pair_t& t, std::string& s ) { std::get< gen::template outer< I > >( t ).template copy_to_binary< gen::template inner< I > >( s ); }
+   void copy_to_binary( std::string& data ) const
+   {
+      std::get< gen::template outer< I > >( m_pair ).template copy_to_binary< gen::template inner< I > >( data );
+   }
 };
 
 #endif
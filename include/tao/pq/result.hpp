@@ -26,6 +26,8 @@
 #include <libpq-fe.h>
 
 #include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/oid.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/result_status.hpp>
 #include <tao/pq/row.hpp>
 
@@ -64,6 +66,8 @@ namespace tao::pq
 
       [[nodiscard]] auto name( const std::size_t column ) const -> std::string;
       [[nodiscard]] auto index( const internal::zsv in_name ) const -> std::size_t;
+      [[nodiscard]] auto format( const std::size_t column ) const -> result_format;
+      [[nodiscard]] auto type( const std::size_t column ) const -> oid;
 
       [[nodiscard]] auto size() const noexcept -> std::size_t
       {
@@ -207,6 +211,7 @@ namespace tao::pq
 
       [[nodiscard]] auto is_null( const std::size_t row, const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t row, const std::size_t column ) const -> const char*;
+      [[nodiscard]] auto length( const std::size_t row, const std::size_t column ) const -> std::size_t;
 
       [[nodiscard]] auto operator[]( const std::size_t row ) const noexcept
       {
@@ -0,0 +1,37 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_RESULT_FORMAT_HPP
+#define TAO_PQ_RESULT_FORMAT_HPP
+
+#include <cstdint>
+#include <string_view>
+
+#include <tao/pq/internal/format_as.hpp>
+
+namespace tao::pq
+{
+   enum class result_format : std::uint8_t
+   {
+      text_format = 0,
+      binary_format = 1
+   };
+
+   [[nodiscard]] constexpr auto taopq_format_as( const result_format rf ) noexcept -> std::string_view
+   {
+      switch( rf ) {
+         case result_format::text_format:
+            return "text";
+
+         case result_format::binary_format:
+            return "binary";
+
+         default:
+            return "<unknown>";
+      }
+   }
+
+}  // namespace tao::pq
+
+#endif
@@ -15,6 +15,7 @@
 #include <tao/pq/bind.hpp>
 #include <tao/pq/internal/exclusive_scan.hpp>
 #include <tao/pq/is_aggregate.hpp>
+#include <tao/pq/oid.hpp>
 
 namespace tao::pq
 {
@@ -43,6 +44,46 @@ namespace tao::pq
    template< typename T >
    concept result_type = result_type_direct< T > || result_type_composite< T >;
 
+   template< typename T >
+   concept result_type_binary = result_type_direct< T > && requires( const char* s, const std::size_t n ) {
+      { result_traits< T >::from_binary( s, n ) } -> std::same_as< T >;
+   };
+
+   namespace internal
+   {
+      // the column types whose binary format matches the text format conversion of the result traits
+
+      [[nodiscard]] constexpr auto is_integral_type( const oid type ) noexcept -> bool
+      {
+         return ( type == oid::int2 ) || ( type == oid::int4 ) || ( type == oid::int8 );
+      }
+
+      [[nodiscard]] constexpr auto is_floating_point_type( const oid type ) noexcept -> bool
+      {
+         return ( type == oid::float4 ) || ( type == oid::float8 );
+      }
+
+      // user-defined types like enums or citext are passed through as-is
+      [[nodiscard]] constexpr auto is_text_type( const oid type ) noexcept -> bool
+      {
+         switch( type ) {
+            case oid::character:
+            case oid::name:
+            case oid::text:
+            case oid::json:
+            case oid::xml:
+            case oid::unknown:
+            case oid::bpchar:
+            case oid::varchar:
+               return true;
+
+            default:
+               return type >= oid::first_user_defined;
+         }
+      }
+
+   }  // namespace internal
+
    template<>
    struct result_traits< const char* >
    {
@@ -59,96 +100,196 @@ namespace tao::pq
       {
          return value;
       }
+
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> std::string_view
+      {
+         return { value, size };
+      }
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_text_type( type );
+      }
    };
 
    template<>
    struct result_traits< bool >
    {
       [[nodiscard]] static auto from( const char* value ) -> bool;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> bool;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return type == oid::boolean;
+      }
    };
 
    template<>
    struct result_traits< char >
    {
       [[nodiscard]] static auto from( const char* value ) -> char;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> char;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_text_type( type );
+      }
    };
 
    template<>
    struct result_traits< signed char >
    {
       [[nodiscard]] static auto from( const char* value ) -> signed char;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> signed char;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< unsigned char >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned char;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> unsigned char;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< short >
    {
       [[nodiscard]] static auto from( const char* value ) -> short;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> short;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< unsigned short >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned short;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> unsigned short;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< int >
    {
       [[nodiscard]] static auto from( const char* value ) -> int;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> int;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< unsigned >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> unsigned;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< long >
    {
       [[nodiscard]] static auto from( const char* value ) -> long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> long;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< unsigned long >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> unsigned long;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< long long >
    {
       [[nodiscard]] static auto from( const char* value ) -> long long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> long long;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< unsigned long long >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned long long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> unsigned long long;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_integral_type( type );
+      }
    };
 
    template<>
    struct result_traits< float >
    {
       [[nodiscard]] static auto from( const char* value ) -> float;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> float;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_floating_point_type( type );
+      }
    };
 
    template<>
    struct result_traits< double >
    {
       [[nodiscard]] static auto from( const char* value ) -> double;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> double;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_floating_point_type( type );
+      }
    };
 
    template<>
    struct result_traits< long double >
    {
       [[nodiscard]] static auto from( const char* value ) -> long double;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> long double;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_floating_point_type( type );
+      }
    };
 
    template<>
@@ -158,12 +299,28 @@ namespace tao::pq
       {
          return value;
       }
+
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> std::string
+      {
+         return { value, size };
+      }
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return internal::is_text_type( type );
+      }
    };
 
    template<>
    struct result_traits< binary >
    {
       [[nodiscard]] static auto from( const char* value ) -> binary;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> binary;
+
+      [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      {
+         return type == oid::bytea;
+      }
    };
 
    namespace internal
@@ -5,10 +5,15 @@
 #ifndef TAO_PQ_RESULT_TRAITS_ARRAY_HPP
 #define TAO_PQ_RESULT_TRAITS_ARRAY_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/is_array.hpp>
+#include <tao/pq/oid.hpp>
 #include <tao/pq/result_traits.hpp>
 
 namespace tao::pq
@@ -77,6 +82,152 @@ namespace tao::pq
          }
       }
 
+      // reads PostgreSQL's binary array format, see array_send() in src/backend/utils/adt/arrayfuncs.c
+      class binary_array_reader
+      {
+      public:
+         static constexpr std::size_t max_dimensions = 6;  // MAXDIM
+
+      private:
+         const char* m_pos;
+         const char* const m_end;
+         std::size_t m_dimensions = 0;
+         bool m_has_null = false;
+         oid m_element = oid::invalid;
+         std::size_t m_sizes[ max_dimensions ] = {};
+
+      public:
+         binary_array_reader( const char* value, const std::size_t size );
+
+         [[nodiscard]] auto dimensions() const noexcept -> std::size_t
+         {
+            return m_dimensions;
+         }
+
+         [[nodiscard]] auto has_null() const noexcept -> bool
+         {
+            return m_has_null;
+         }
+
+         [[nodiscard]] auto element() const noexcept -> oid
+         {
+            return m_element;
+         }
+
+         [[nodiscard]] auto size( const std::size_t dimension ) const noexcept -> std::size_t
+         {
+            return m_sizes[ dimension ];
+         }
+
+         [[nodiscard]] auto remaining() const noexcept -> std::size_t
+         {
+            return static_cast< std::size_t >( m_end - m_pos );
+         }
+
+         // returns nullptr for NULL elements
+         [[nodiscard]] auto next( std::size_t& size ) -> const char*;
+
+         // fast path for fixed-width elements without NULLs
+         template< typename T >
+         void next_n( T* data, const std::size_t n )
+         {
+            constexpr std::size_t stride = sizeof( std::int32_t ) + sizeof( T );
+            if( static_cast< std::size_t >( m_end - m_pos ) < n * stride ) {
+               throw std::invalid_argument( "unexpected end of binary array" );
+            }
+            for( std::size_t i = 0; i != n; ++i ) {
+               if( internal::from_big_endian< std::int32_t >( m_pos ) != static_cast< std::int32_t >( sizeof( T ) ) ) {
+                  throw std::invalid_argument( "unexpected binary array element size" );
+               }
+               data[ i ] = internal::from_big_endian< T >( m_pos + sizeof( std::int32_t ) );
+               m_pos += stride;
+            }
+         }
+
+         void finish() const;
+      };
+
+      template< typename T >
+      [[nodiscard]] constexpr auto is_fixed_width_element( const oid element ) noexcept -> bool
+      {
+         if constexpr( std::is_same_v< T, short > || std::is_same_v< T, int > || std::is_same_v< T, long > || std::is_same_v< T, long long > ) {
+            switch( sizeof( T ) ) {
+               case 2:
+                  return element == oid::int2;
+               case 4:
+                  return element == oid::int4;
+               case 8:
+                  return element == oid::int8;
+               default:
+                  return false;
+            }
+         }
+         else if constexpr( std::is_same_v< T, float > ) {
+            return element == oid::float4;
+         }
+         else if constexpr( std::is_same_v< T, double > ) {
+            return element == oid::float8;
+         }
+         else {
+            return false;
+         }
+      }
+
+      template< typename T >
+      [[nodiscard]] auto parse_binary( binary_array_reader& reader, const std::size_t /*unused*/ ) -> T
+      {
+         if constexpr( requires { result_traits< T >::accepts_binary( oid() ); } ) {
+            if( !result_traits< T >::accepts_binary( reader.element() ) ) {
+               throw std::invalid_argument( "unexpected binary array element type" );
+            }
+         }
+         std::size_t size;
+         const char* value = reader.next( size );
+         if( value == nullptr ) {
+            if constexpr( requires { result_traits< T >::null(); } ) {
+               return result_traits< T >::null();
+            }
+            else {
+               throw std::invalid_argument( "unexpected NULL value" );
+            }
+         }
+         return result_traits< T >::from_binary( value, size );
+      }
+
+      template< typename T >
+         requires pq::is_array_result< T >
+      [[nodiscard]] auto parse_binary( binary_array_reader& reader, const std::size_t dimension ) -> T
+      {
+         using value_type = typename T::value_type;
+         if( ( dimension + 1 < reader.dimensions() ) != pq::is_array_result< value_type > ) {
+            throw std::invalid_argument( "array dimensions mismatch" );
+         }
+
+         T container;
+         const std::size_t n = reader.size( dimension );
+         if constexpr( requires { container.resize( n ); container.data(); } ) {
+            if constexpr( std::is_arithmetic_v< value_type > ) {
+               if( !reader.has_null() && internal::is_fixed_width_element< value_type >( reader.element() ) ) {
+                  container.resize( n );
+                  reader.next_n( container.data(), n );
+                  return container;
+               }
+            }
+         }
+         if constexpr( requires { container.reserve( n ); } ) {
+            container.reserve( n );
+         }
+         for( std::size_t i = 0; i != n; ++i ) {
+            if constexpr( requires { container.push_back( parse_binary< value_type >( reader, dimension + 1 ) ); } ) {
+               container.push_back( parse_binary< value_type >( reader, dimension + 1 ) );
+            }
+            else {
+               container.insert( parse_binary< value_type >( reader, dimension + 1 ) );
+            }
+         }
+         return container;
+      }
+
    }  // namespace internal
 
    template< internal::array_result_type T >
@@ -90,6 +241,18 @@ namespace tao::pq
          }
          return container;
       }
+
+      static auto from_binary( const char* value, const std::size_t size ) -> T
+         requires result_type_binary< typename T::value_type >
+      {
+         internal::binary_array_reader reader( value, size );
+         if( reader.dimensions() == 0 ) {
+            return T();
+         }
+         auto container = internal::parse_binary< T >( reader, 0 );
+         reader.finish();
+         return container;
+      }
    };
 
 }  // namespace tao::pq
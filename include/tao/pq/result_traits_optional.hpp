@@ -25,6 +25,18 @@ struct tao::pq::result_traits< std::optional< T > >
       return result_traits< T >::from( value );
    }
 
+   [[nodiscard]] static auto from_binary( const char* value, const std::size_t size ) -> std::optional< T >
+      requires result_type_binary< T >
+   {
+      return result_traits< T >::from_binary( value, size );
+   }
+
+   [[nodiscard]] static constexpr auto accepts_binary( const oid type ) noexcept -> bool
+      requires requires { result_traits< T >::accepts_binary( oid() ); }
+   {
+      return result_traits< T >::accepts_binary( type );
+   }
+
    template< typename Row >
    [[nodiscard]] static auto from( const Row& row ) -> std::optional< T >
    {
@@ -19,6 +19,8 @@
 #include <tao/pq/internal/demangle.hpp>
 #include <tao/pq/internal/zsv.hpp>
 #include <tao/pq/is_aggregate.hpp>
+#include <tao/pq/oid.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/result_traits.hpp>
 
 namespace tao::pq
@@ -57,6 +59,8 @@ namespace tao::pq
 
       [[nodiscard]] auto name( const std::size_t column ) const -> std::string;
       [[nodiscard]] auto index( const internal::zsv in_name ) const -> std::size_t;
+      [[nodiscard]] auto format( const std::size_t column ) const -> result_format;
+      [[nodiscard]] auto type( const std::size_t column ) const -> oid;
 
    private:
       class const_iterator
@@ -189,6 +193,7 @@ namespace tao::pq
 
       [[nodiscard]] auto is_null( const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t column ) const -> const char*;
+      [[nodiscard]] auto length( const std::size_t column ) const -> std::size_t;
 
       template< result_type_direct T >
       [[nodiscard]] auto get( const std::size_t column ) const -> T
@@ -198,6 +203,19 @@ namespace tao::pq
                return result_traits< T >::null();
             }
          }
+         if( format( column ) == result_format::binary_format ) {
+            if constexpr( result_type_binary< T > ) {
+               if constexpr( requires { result_traits< T >::accepts_binary( oid() ); } ) {
+                  if( const auto t = type( column ); !result_traits< T >::accepts_binary( t ) ) {
+                     throw std::runtime_error( std::format( "column of type {} can not be converted from binary format to '{}'", static_cast< Oid >( t ), internal::demangle< T >() ) );
+                  }
+               }
+               return result_traits< T >::from_binary( get( column ), length( column ) );
+            }
+            else {
+               throw std::runtime_error( std::format( "datatype '{}' does not support binary result format", internal::demangle< T >() ) );
+            }
+         }
          return result_traits< T >::from( get( column ) );
       }
 
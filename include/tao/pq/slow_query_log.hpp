@@ -0,0 +1,89 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_SLOW_QUERY_LOG_HPP
+#define TAO_PQ_SLOW_QUERY_LOG_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <tao/pq/internal/chained_log.hpp>
+#include <tao/pq/internal/periodic_thread.hpp>
+
+namespace tao::pq
+{
+   namespace internal
+   {
+      struct slow_query_data;
+
+   }  // namespace internal
+
+   struct slow_query
+   {
+      std::chrono::system_clock::time_point start;
+      std::chrono::nanoseconds duration = {};
+
+      std::string statement;                                   // the SQL or the name of the prepared statement
+      std::vector< std::optional< std::string > > parameters;  // truncated, binary parameters as hex
+
+      std::uint64_t rows = 0;  // returned or affected
+      int backend_pid = 0;
+      bool error = false;
+      bool sampled = false;  // below the threshold
+   };
+
+   // formats a single line, e.g. for a log file
+   [[nodiscard]] auto to_string( const slow_query& query ) -> std::string;
+
+   struct slow_query_options
+   {
+      std::chrono::nanoseconds threshold = std::chrono::milliseconds( 100 );
+
+      // probability to record a query that is faster than the threshold
+      double sample_rate = 0.0;
+
+      // parameters are cut after this number of characters
+      std::size_t max_parameter_size = 64;
+
+      // entries that do not fit into the buffer are dropped
+      std::size_t buffer_size = 4096;
+
+      std::chrono::milliseconds flush_interval = std::chrono::milliseconds( 100 );
+   };
+
+   // records slow queries and passes them to a writer that runs in a background thread
+   class slow_query_log final
+      : public internal::chained_log
+   {
+   public:
+      using writer_t = std::function< void( const slow_query& ) >;
+
+   private:
+      std::shared_ptr< internal::slow_query_data > m_data;
+      internal::periodic_thread m_writer;
+
+   public:
+      explicit slow_query_log( writer_t writer, const slow_query_options& options = {} );
+
+      slow_query_log( const slow_query_log& ) = delete;
+      slow_query_log( slow_query_log&& ) = delete;
+      void operator=( const slow_query_log& ) = delete;
+      void operator=( slow_query_log&& ) = delete;
+
+      // writes the remaining entries
+      ~slow_query_log() = default;
+
+      // the number of entries that were lost because the buffer was full
+      [[nodiscard]] auto dropped() const noexcept -> std::uint64_t;
+   };
+
+}  // namespace tao::pq
+
+#endif
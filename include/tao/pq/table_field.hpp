@@ -36,6 +36,7 @@ namespace tao::pq
 
       [[nodiscard]] auto is_null() const -> bool;
       [[nodiscard]] auto get() const -> const char*;
+      [[nodiscard]] auto length() const -> std::size_t;
 
       template< result_type T >
          requires( result_traits_size< T > == 1 )
@@ -8,35 +8,111 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <format>
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <stdexcept>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <libpq-fe.h>
 
+#include <tao/pq/column_batch.hpp>
+#include <tao/pq/csv_options.hpp>
+#include <tao/pq/internal/demangle.hpp>
 #include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/result_traits.hpp>
 #include <tao/pq/table_row.hpp>
 #include <tao/pq/transaction.hpp>
 
 namespace tao::pq
 {
+   namespace internal
+   {
+      class copy_read_ahead;
+
+      struct copy_read_ahead_deleter
+      {
+         void operator()( copy_read_ahead* p ) const noexcept;
+      };
+
+   }  // namespace internal
+
    class table_reader final
    {
+   public:
+      struct copy_to_fd_result
+      {
+         std::size_t bytes = 0;
+         std::size_t rows = 0;
+      };
+
    protected:
       std::shared_ptr< transaction_base > m_previous;
       std::shared_ptr< transaction > m_transaction;
       std::size_t m_columns;  // NOLINT(modernize-use-default-member-init)
       std::unique_ptr< char, decltype( &PQfreemem ) > m_buffer;
+      std::string_view m_raw_data;
       std::vector< const char* > m_data;
 
+      // text format only
+      std::vector< std::size_t > m_positions;
+
+      // CSV format only
+      std::optional< csv_options > m_csv;
+
+      // binary format only
+      bool m_binary = false;
+      bool m_header = false;
+      std::vector< std::size_t > m_lengths;
+
+      std::size_t m_read_ahead = 0;
+      std::unique_ptr< internal::copy_read_ahead, internal::copy_read_ahead_deleter > m_read_ahead_buffers;
+
       void check_result();
 
+      [[nodiscard]] auto get_copy_data( char*& buffer ) -> std::size_t;
+
+      template< typename T >
+      void append_field( std::vector< T >& values, std::vector< std::uint8_t >& nulls, const std::size_t column ) const
+      {
+         const char* const value = m_data[ column ];
+         if( value == nullptr ) {
+            values.emplace_back();
+            nulls.push_back( 1 );
+            return;
+         }
+         if( m_binary ) {
+            if constexpr( result_type_binary< T > ) {
+               values.push_back( result_traits< T >::from_binary( value, m_lengths[ column ] ) );
+            }
+            else {
+               throw std::runtime_error( std::format( "datatype '{}' does not support binary result format", internal::demangle< T >() ) );
+            }
+         }
+         else {
+            values.push_back( result_traits< T >::from( value ) );
+         }
+         nulls.push_back( 0 );
+      }
+
+      template< typename... Ts, std::size_t... Is >
+      void append_row( column_batch< Ts... >& batch, std::index_sequence< Is... > /*unused*/ ) const
+      {
+         ( table_reader::append_field( std::get< Is >( batch.m_values ), std::get< Is >( batch.m_nulls ), Is ), ... );
+      }
+
+      [[nodiscard]] auto parse_text_data() noexcept -> bool;
+      [[nodiscard]] auto parse_csv_data() -> bool;
+      [[nodiscard]] auto parse_binary_data() -> bool;
+
    public:
       template< parameter_type... As >
       table_reader( const std::shared_ptr< transaction >& transaction, const internal::zsv statement, As&&... as )
@@ -61,10 +137,50 @@ namespace tao::pq
          return m_columns;
       }
 
+      // true for COPY ... TO STDOUT ( FORMAT binary )
+      [[nodiscard]] auto is_binary() const noexcept -> bool
+      {
+         return m_binary;
+      }
+
+      // for COPY ... TO STDOUT ( FORMAT csv ), the options must match the statement
+      [[nodiscard]] auto csv() const noexcept -> const std::optional< csv_options >&
+      {
+         return m_csv;
+      }
+
+      void set_csv( csv_options options = {} );
+
+      void reset_csv() noexcept
+      {
+         m_csv = std::nullopt;
+      }
+
+      // the number of rows that a background thread receives ahead of the caller,
+      // zero disables the read-ahead, must be set before the first row is read.
+      // note: the connection's poll callback, log, and notification handlers are
+      // called from the background thread while it is active. destroying the reader
+      // before all data was received cancels the running COPY statement.
+      [[nodiscard]] auto read_ahead() const noexcept -> std::size_t
+      {
+         return m_read_ahead;
+      }
+
+      void set_read_ahead( const std::size_t rows );
+
+      void reset_read_ahead() noexcept
+      {
+         m_read_ahead = 0;
+      }
+
+      // writes all remaining data unchanged to a file descriptor, binary data includes
+      // its header and trailer. must be called before the first row is read.
+      auto copy_to_fd( const int fd ) -> copy_to_fd_result;
+
       // note: the following API is experimental and subject to change
 
       [[nodiscard]] auto get_raw_data() -> std::string_view;
-      [[nodiscard]] auto parse_data() noexcept -> bool;
+      [[nodiscard]] auto parse_data() -> bool;
 
       [[nodiscard]] auto get_row() -> bool
       {
@@ -82,6 +198,12 @@ namespace tao::pq
          return m_data;
       }
 
+      // binary format only, fields are not zero-terminated
+      [[nodiscard]] auto raw_lengths() const noexcept -> const std::vector< std::size_t >&
+      {
+         return m_lengths;
+      }
+
       [[nodiscard]] auto row() noexcept -> table_row
       {
          assert( has_data() );
@@ -148,6 +270,37 @@ namespace tao::pq
          return end();
       }
 
+      // reads up to n rows into the batch, reusing the batch's capacity,
+      // returns the number of rows read, which is zero at the end of the data
+      template< typename... Ts >
+      auto read_batch( column_batch< Ts... >& batch, const std::size_t n ) -> std::size_t
+      {
+         if( sizeof...( Ts ) != columns() ) {
+            throw std::out_of_range( std::format( "column_batch requires {} columns, but table_reader has {} columns", sizeof...( Ts ), columns() ) );
+         }
+         batch.clear();
+         batch.reserve( n );
+         while( ( batch.m_rows < n ) && get_row() ) {
+            try {
+               table_reader::append_row( batch, std::index_sequence_for< Ts... >() );
+            }
+            catch( ... ) {
+               batch.resize( batch.m_rows );
+               throw;
+            }
+            ++batch.m_rows;
+         }
+         return batch.m_rows;
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto read_batch( const std::size_t n ) -> column_batch< Ts... >
+      {
+         column_batch< Ts... > batch;
+         std::ignore = read_batch( batch, n );
+         return batch;
+      }
+
       template< typename T >
          requires result_type< typename T::value_type >
       [[nodiscard]] auto as_container() -> T
@@ -15,6 +15,7 @@
 #include <utility>
 
 #include <tao/pq/internal/demangle.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/result_traits.hpp>
 #include <tao/pq/table_field.hpp>
 
@@ -177,8 +178,11 @@ namespace tao::pq
          return end();
       }
 
+      [[nodiscard]] auto format( const std::size_t column ) const -> result_format;
+
       [[nodiscard]] auto is_null( const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t column ) const -> const char*;
+      [[nodiscard]] auto length( const std::size_t column ) const -> std::size_t;
 
       template< result_type_direct T >
       [[nodiscard]] auto get( const std::size_t column ) const -> T
@@ -192,6 +196,14 @@ namespace tao::pq
                throw std::invalid_argument( "unexpected NULL value" );
             }
          }
+         if( format( column ) == result_format::binary_format ) {
+            if constexpr( result_type_binary< T > ) {
+               return result_traits< T >::from_binary( value, length( column ) );
+            }
+            else {
+               throw std::runtime_error( std::format( "datatype '{}' does not support binary result format", internal::demangle< T >() ) );
+            }
+         }
          return result_traits< T >::from( value );
       }
 
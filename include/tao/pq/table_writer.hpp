@@ -6,7 +6,12 @@
 #define TAO_PQ_TABLE_WRITER_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #if !( defined( __cpp_pack_indexing ) && ( __cplusplus >= 202302L ) )
@@ -15,58 +20,150 @@
 #include <type_traits>
 #include <utility>
 
+#include <tao/pq/csv_options.hpp>
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/gen.hpp>
 #include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/null.hpp>
+#include <tao/pq/oid.hpp>
 #include <tao/pq/parameter.hpp>
 #include <tao/pq/parameter_traits.hpp>
 #include <tao/pq/transaction.hpp>
 
 namespace tao::pq
 {
+   namespace internal
+   {
+      // appends a (non-NULL) value as a CSV field, quoted only if necessary
+      void csv_append( std::string& buffer, const std::string_view value, const csv_options& csv );
+
+      // converts a field in COPY's text format to CSV, the field is unescaped in place
+      void csv_append_text( std::string& buffer, std::string& field, const csv_options& csv );
+
+   }  // namespace internal
+
    class table_writer final
    {
+   public:
+      static constexpr std::size_t default_flush_threshold = 64 * 1024;
+
    protected:
       std::shared_ptr< transaction_base > m_previous;
       std::shared_ptr< transaction > m_transaction;
 
+      std::string m_buffer;
+      std::size_t m_flush_threshold = default_flush_threshold;
+      std::size_t m_columns = 0;
+      bool m_binary = false;
+
+      std::optional< csv_options > m_csv;
+      std::string m_field;
+
+      void flush_if_needed()
+      {
+         if( m_buffer.size() >= m_flush_threshold ) {
+            table_writer::flush();
+         }
+      }
+
+      // uses the text value directly, binary values are converted from COPY's text format
+      template< std::size_t I, typename T >
+      void csv_copy_to( const T& t )
+      {
+         if constexpr( std::is_same_v< T, parameter_traits< null_t > > ) {
+            // avoids -Wnonnull for the value that is known to be NULL at compile time
+            m_buffer += m_csv->null;
+         }
+         else if( ( t.template format< I >() == 0 ) || ( t.template type< I >() == oid::text ) ) {
+            const char* const value = t.template value< I >();
+            if( value == nullptr ) {
+               m_buffer += m_csv->null;
+            }
+            else if( t.template format< I >() == 0 ) {
+               internal::csv_append( m_buffer, value, *m_csv );
+            }
+            else {
+               internal::csv_append( m_buffer, std::string_view( value, static_cast< std::size_t >( t.template length< I >() ) ), *m_csv );
+            }
+         }
+         else {
+            m_field.clear();
+            t.template copy_to< I >( m_field );
+            internal::csv_append_text( m_buffer, m_field, *m_csv );
+         }
+         m_buffer += m_csv->delimiter;
+      }
+
 #if defined( __cpp_pack_indexing ) && ( __cplusplus >= 202302L )
 
-      template< std::size_t... Os, std::size_t... Is >
+      template< bool Binary, std::size_t... Os, std::size_t... Is >
       void insert_indexed( std::index_sequence< Os... > /*unused*/,
                            std::index_sequence< Is... > /*unused*/,
                            const auto&... ts )
       {
-         std::string buffer;
-         ( ( ts...[ Os ].template copy_to< Is >( buffer ), buffer += '\t' ), ... );
-         *buffer.rbegin() = '\n';
-         table_writer::insert_raw( buffer );
+         const auto size = m_buffer.size();
+         try {
+            if constexpr( Binary ) {
+               internal::append_big_endian( m_buffer, static_cast< std::int16_t >( sizeof...( Is ) ) );
+               ( ts...[ Os ].template copy_to_binary< Is >( m_buffer ), ... );
+            }
+            else if( m_csv ) {
+               ( table_writer::csv_copy_to< Is >( ts...[ Os ] ), ... );
+               *m_buffer.rbegin() = '\n';
+            }
+            else {
+               ( ( ts...[ Os ].template copy_to< Is >( m_buffer ), m_buffer += '\t' ), ... );
+               *m_buffer.rbegin() = '\n';
+            }
+         }
+         catch( ... ) {
+            m_buffer.resize( size );
+            throw;
+         }
+         table_writer::flush_if_needed();
       }
 
-      template< typename... Ts >
+      template< bool Binary, typename... Ts >
       void insert_traits( const Ts&... ts )
       {
          using gen = internal::gen< Ts::columns... >;
-         table_writer::insert_indexed( typename gen::outer_sequence(), typename gen::inner_sequence(), ts... );
+         table_writer::insert_indexed< Binary >( typename gen::outer_sequence(), typename gen::inner_sequence(), ts... );
       }
 
 #else
 
-      template< std::size_t... Os, std::size_t... Is, typename... Ts >
+      template< bool Binary, std::size_t... Os, std::size_t... Is, typename... Ts >
       void insert_indexed( std::index_sequence< Os... > /*unused*/,
                            std::index_sequence< Is... > /*unused*/,
                            const std::tuple< Ts... >& tuple )
       {
-         std::string buffer;
-         ( ( std::get< Os >( tuple ).template copy_to< Is >( buffer ), buffer += '\t' ), ... );
-         *buffer.rbegin() = '\n';
-         table_writer::insert_raw( buffer );
+         const auto size = m_buffer.size();
+         try {
+            if constexpr( Binary ) {
+               internal::append_big_endian( m_buffer, static_cast< std::int16_t >( sizeof...( Is ) ) );
+               ( std::get< Os >( tuple ).template copy_to_binary< Is >( m_buffer ), ... );
+            }
+            else if( m_csv ) {
+               ( table_writer::csv_copy_to< Is >( std::get< Os >( tuple ) ), ... );
+               *m_buffer.rbegin() = '\n';
+            }
+            else {
+               ( ( std::get< Os >( tuple ).template copy_to< Is >( m_buffer ), m_buffer += '\t' ), ... );
+               *m_buffer.rbegin() = '\n';
+            }
+         }
+         catch( ... ) {
+            m_buffer.resize( size );
+            throw;
+         }
+         table_writer::flush_if_needed();
       }
 
-      template< typename... Ts >
+      template< bool Binary, typename... Ts >
       void insert_traits( const Ts&... ts )
       {
          using gen = internal::gen< Ts::columns... >;
-         table_writer::insert_indexed( typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ts... ) );
+         table_writer::insert_indexed< Binary >( typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ts... ) );
       }
 
 #endif
@@ -90,15 +187,73 @@ namespace tao::pq
       void operator=( const table_writer& ) = delete;
       void operator=( table_writer&& ) = delete;
 
+      // data is buffered and sent once the buffer reaches the flush threshold
+      [[nodiscard]] auto flush_threshold() const noexcept -> std::size_t
+      {
+         return m_flush_threshold;
+      }
+
+      void set_flush_threshold( const std::size_t threshold ) noexcept
+      {
+         m_flush_threshold = threshold;
+      }
+
+      void reset_flush_threshold() noexcept
+      {
+         m_flush_threshold = default_flush_threshold;
+      }
+
+      [[nodiscard]] auto columns() const noexcept -> std::size_t
+      {
+         return m_columns;
+      }
+
+      // true for COPY ... FROM STDIN ( FORMAT binary )
+      [[nodiscard]] auto is_binary() const noexcept -> bool
+      {
+         return m_binary;
+      }
+
+      // for COPY ... FROM STDIN ( FORMAT csv ), the options must match the statement
+      [[nodiscard]] auto csv() const noexcept -> const std::optional< csv_options >&
+      {
+         return m_csv;
+      }
+
+      void set_csv( csv_options options = {} );
+
+      void reset_csv() noexcept
+      {
+         m_csv = std::nullopt;
+      }
+
       void insert_raw( const std::string_view data );
 
+      // streams a file in the statement's format, binary files include their header and trailer.
+      // the optional validation checks the number of columns of every row before anything is sent,
+      // progress is called with the number of bytes sent so far and the file size.
+      // returns the number of bytes sent.
+      auto insert_file( const std::filesystem::path& path,
+                        const bool validate = false,
+                        const std::function< void( std::size_t sent, std::size_t total ) >& progress = {} ) -> std::size_t;
+
       template< parameter_type... As >
          requires( sizeof...( As ) >= 1 )
       void insert( As&&... as )
       {
-         return insert_traits( parameter_traits< std::decay_t< As > >( std::forward< As >( as ) )... );
+         if( m_binary ) {
+            if constexpr( ( parameter_type_binary< As > && ... ) ) {
+               return insert_traits< true >( parameter_traits< std::decay_t< As > >( std::forward< As >( as ) )... );
+            }
+            else {
+               throw std::invalid_argument( "binary COPY requires parameters with binary support" );
+            }
+         }
+         return insert_traits< false >( parameter_traits< std::decay_t< As > >( std::forward< As >( as ) )... );
       }
 
+      void flush();
+
       auto commit() -> std::size_t;
    };
 
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_TRACE_HPP
+#define TAO_PQ_TRACE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include <tao/pq/log.hpp>
+
+namespace tao::pq
+{
+   // the points at which the library calls into the tracing policy,
+   // each corresponds to one hook of pq::log
+   enum class trace_point : std::uint8_t
+   {
+      connection_pool_acquire,
+      connection_pool_create,
+      connection_pool_release,
+      connection_pool_discard,
+      connection_pool_counts,
+
+      connection_send_query,
+      connection_send_query_result,
+      connection_send_query_prepared,
+      connection_send_query_prepared_result,
+      connection_wait,
+      connection_poll,
+      connection_poll_result,
+      connection_is_busy_result,
+      connection_consume_input,
+      connection_consume_input_result,
+      connection_flush,
+      connection_flush_result,
+      connection_get_result,
+      connection_get_result_result,
+      connection_enter_pipeline_mode_result,
+      connection_exit_pipeline_mode,
+      connection_exit_pipeline_mode_result,
+      connection_pipeline_sync,
+      connection_pipeline_sync_result,
+
+      transaction_destructor_rollback_failed
+   };
+
+   // the default policy, calls the hooks of the log handler
+   struct runtime_trace
+   {
+      template< trace_point P >
+      [[nodiscard]] static auto hook( log& l ) noexcept -> auto&
+      {
+         // clang-format off
+         if constexpr( P == trace_point::connection_pool_acquire ) { return l.connection_pool.acquire; }
+         else if constexpr( P == trace_point::connection_pool_create ) { return l.connection_pool.create; }
+         else if constexpr( P == trace_point::connection_pool_release ) { return l.connection_pool.release; }
+         else if constexpr( P == trace_point::connection_pool_discard ) { return l.connection_pool.discard; }
+         else if constexpr( P == trace_point::connection_pool_counts ) { return l.connection_pool.counts; }
+         else if constexpr( P == trace_point::connection_send_query ) { return l.connection.send_query; }
+         else if constexpr( P == trace_point::connection_send_query_result ) { return l.connection.send_query.result; }
+         else if constexpr( P == trace_point::connection_send_query_prepared ) { return l.connection.send_query_prepared; }
+         else if constexpr( P == trace_point::connection_send_query_prepared_result ) { return l.connection.send_query_prepared.result; }
+         else if constexpr( P == trace_point::connection_wait ) { return l.connection.wait; }
+         else if constexpr( P == trace_point::connection_poll ) { return l.connection.poll; }
+         else if constexpr( P == trace_point::connection_poll_result ) { return l.connection.poll.result; }
+         else if constexpr( P == trace_point::connection_is_busy_result ) { return l.connection.is_busy.result; }
+         else if constexpr( P == trace_point::connection_consume_input ) { return l.connection.consume_input; }
+         else if constexpr( P == trace_point::connection_consume_input_result ) { return l.connection.consume_input.result; }
+         else if constexpr( P == trace_point::connection_flush ) { return l.connection.flush; }
+         else if constexpr( P == trace_point::connection_flush_result ) { return l.connection.flush.result; }
+         else if constexpr( P == trace_point::connection_get_result ) { return l.connection.get_result; }
+         else if constexpr( P == trace_point::connection_get_result_result ) { return l.connection.get_result.result; }
+         else if constexpr( P == trace_point::connection_enter_pipeline_mode_result ) { return l.connection.enter_pipeline_mode.result; }
+         else if constexpr( P == trace_point::connection_exit_pipeline_mode ) { return l.connection.exit_pipeline_mode; }
+         else if constexpr( P == trace_point::connection_exit_pipeline_mode_result ) { return l.connection.exit_pipeline_mode.result; }
+         else if constexpr( P == trace_point::connection_pipeline_sync ) { return l.connection.pipeline_sync; }
+         else if constexpr( P == trace_point::connection_pipeline_sync_result ) { return l.connection.pipeline_sync.result; }
+         else { static_assert( P == trace_point::transaction_destructor_rollback_failed ); return l.transaction.destructor_rollback_failed; }
+         // clang-format on
+      }
+
+      template< trace_point P >
+      [[nodiscard]] static auto active( const std::shared_ptr< log >& log ) noexcept -> bool
+      {
+         return log && static_cast< bool >( hook< P >( *log ) );
+      }
+
+      template< trace_point P, typename... Ts >
+      static void call( const std::shared_ptr< log >& log, Ts&&... ts )
+      {
+         if( active< P >( log ) ) {
+            hook< P >( *log )( std::forward< Ts >( ts )... );
+         }
+      }
+   };
+
+   // removes all hooks, log handlers are ignored
+   struct no_trace
+   {
+      template< trace_point P >
+      [[nodiscard]] static constexpr auto active( const std::shared_ptr< log >& /*unused*/ ) noexcept -> bool
+      {
+         return false;
+      }
+
+      template< trace_point P, typename... Ts >
+      static void call( const std::shared_ptr< log >& /*unused*/, Ts&&... /*unused*/ ) noexcept
+      {}
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -14,6 +14,7 @@
 #include <tao/pq/internal/zsv.hpp>
 #include <tao/pq/parameter.hpp>
 #include <tao/pq/transaction_base.hpp>
+#include <tao/pq/try_result.hpp>
 
 namespace tao::pq
 {
@@ -46,6 +47,15 @@ namespace tao::pq
          return transaction_base::get_result( start );
       }
 
+      // errors reported by the server are returned instead of thrown
+      template< parameter_type... As >
+      [[nodiscard]] auto try_execute( const internal::zsv statement, As&&... as ) -> try_result
+      {
+         const auto start = std::chrono::steady_clock::now();
+         transaction_base::send( statement, std::forward< As >( as )... );
+         return transaction_base::try_get_result( start );
+      }
+
       void commit();
       void rollback();
    };
@@ -21,6 +21,7 @@
 #include <tao/pq/parameter.hpp>
 #include <tao/pq/parameter_traits.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/try_result.hpp>
 
 namespace tao::pq
 {
@@ -51,6 +52,8 @@ namespace tao::pq
       [[nodiscard]] auto current_transaction() const noexcept -> transaction_base*&;
       void check_current_transaction() const;
 
+      [[nodiscard]] auto get_raw_result( const std::chrono::steady_clock::time_point start ) -> std::unique_ptr< PGresult, decltype( &PQclear ) >;
+
       void send_params( const char* statement,
                         const int n_params,
                         const Oid types[],
@@ -141,6 +144,10 @@ namespace tao::pq
 #endif
 
       [[nodiscard]] auto get_result( const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now() ) -> result;
+
+      // does not throw for errors reported by the server, other errors are still thrown
+      [[nodiscard]] auto try_get_result( const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now() ) -> try_result;
+
       void consume_pipeline_sync( const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now() );
    };
 
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_TRY_RESULT_HPP
+#define TAO_PQ_TRY_RESULT_HPP
+
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <tao/pq/exception.hpp>
+#include <tao/pq/internal/unreachable.hpp>
+#include <tao/pq/result.hpp>
+
+namespace tao::pq
+{
+   // an error reported by the server, see sql_error
+   struct sql_error_info
+   {
+      std::string sqlstate;
+      std::string message;  // the primary message
+      std::string detail;   // empty if the server did not send a detail message
+      std::string what;     // the full error message, empty if not set
+
+      // throws the exception that execute() would have thrown, with what() as the exception's message
+      [[noreturn]] void raise() const
+      {
+         internal::throw_sqlstate( what.empty() ? message.c_str() : what.c_str(), sqlstate );
+      }
+   };
+
+   // either a result or the error reported by the server, modelled after std::expected
+   class try_result final
+   {
+   private:
+      std::variant< result, sql_error_info > m_value;
+
+   public:
+      try_result( result&& r ) noexcept  // NOLINT(google-explicit-constructor)
+         : m_value( std::in_place_index< 0 >, std::move( r ) )
+      {}
+
+      try_result( sql_error_info&& e ) noexcept  // NOLINT(google-explicit-constructor)
+         : m_value( std::in_place_index< 1 >, std::move( e ) )
+      {}
+
+      [[nodiscard]] auto has_value() const noexcept -> bool
+      {
+         return m_value.index() == 0;
+      }
+
+      [[nodiscard]] explicit operator bool() const noexcept
+      {
+         return has_value();
+      }
+
+      // throws the corresponding sql_error if there is no result
+      [[nodiscard]] auto value() const& -> const result&
+      {
+         if( !has_value() ) {
+            error().raise();
+         }
+         return *std::get_if< 0 >( &m_value );
+      }
+
+      [[nodiscard]] auto value() && -> result
+      {
+         if( !has_value() ) {
+            error().raise();
+         }
+         return std::move( *std::get_if< 0 >( &m_value ) );
+      }
+
+      // the behaviour is undefined if there is no result
+      [[nodiscard]] auto operator*() const& noexcept -> const result&
+      {
+         if( const auto* r = std::get_if< 0 >( &m_value ) ) {
+            return *r;
+         }
+         TAO_PQ_INTERNAL_UNREACHABLE;  // LCOV_EXCL_LINE
+      }
+
+      [[nodiscard]] auto operator->() const noexcept -> const result*
+      {
+         return std::get_if< 0 >( &m_value );
+      }
+
+      // the behaviour is undefined if there is a result
+      [[nodiscard]] auto error() const& noexcept -> const sql_error_info&
+      {
+         if( const auto* e = std::get_if< 1 >( &m_value ) ) {
+            return *e;
+         }
+         TAO_PQ_INTERNAL_UNREACHABLE;  // LCOV_EXCL_LINE
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
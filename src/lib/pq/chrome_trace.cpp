@@ -0,0 +1,328 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/chrome_trace.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/internal/connection_map.hpp>
+#include <tao/pq/internal/json.hpp>
+#include <tao/pq/internal/ring_buffer.hpp>
+#include <tao/pq/internal/statement_tracker.hpp>
+#include <tao/pq/log.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      using clock = std::chrono::steady_clock;
+
+      constexpr std::size_t max_name_size = 64;
+      constexpr std::size_t flush_size = 1024 * 1024;
+      constexpr std::chrono::milliseconds flush_interval( 100 );
+
+      // cuts at a UTF-8 character boundary
+      [[nodiscard]] auto event_name( const std::string_view statement ) noexcept -> std::string_view
+      {
+         if( statement.size() <= max_name_size ) {
+            return statement;
+         }
+         auto n = max_name_size;
+         while( ( n != 0 ) && ( ( static_cast< unsigned char >( statement[ n ] ) & 0xc0 ) == 0x80 ) ) {
+            --n;
+         }
+         return statement.substr( 0, n );
+      }
+
+      [[nodiscard]] auto us( const clock::duration d ) noexcept -> double
+      {
+         return std::chrono::duration< double, std::micro >( d ).count();
+      }
+
+      // small numbers are easier to read in the trace viewer than hashed std::thread::id
+      [[nodiscard]] auto thread_id() noexcept -> std::uint64_t
+      {
+         static std::atomic< std::uint64_t > next = 1;
+         thread_local const auto id = next++;
+         return id;
+      }
+
+   }  // namespace
+
+   namespace internal
+   {
+      // formatted by the writer thread, connections only fill in the values
+      struct chrome_trace_event
+      {
+         const char* name = nullptr;  // nullptr uses the statement
+         const char* category = nullptr;
+         clock::time_point start;
+         clock::time_point end;
+         std::uint64_t thread = 0;
+         int connection = 0;
+
+         // only for statements
+         std::string statement;
+         clock::duration send = {};
+         clock::duration wait = {};
+         clock::duration decode = {};
+         ExecStatusType status = PGRES_EMPTY_QUERY;
+      };
+
+      struct chrome_trace_data final
+         : statement_tracker< std::string >
+      {
+         // the spans besides statements
+         struct connection_state
+         {
+            std::deque< clock::time_point > syncs;
+            std::optional< clock::time_point > copy;
+            std::optional< clock::time_point > transaction;
+
+            [[nodiscard]] auto empty() const noexcept -> bool
+            {
+               return syncs.empty() && !copy && !transaction;
+            }
+         };
+
+         const clock::time_point epoch = clock::now();
+
+         connection_map< connection_state > connections;
+
+         ring_buffer< chrome_trace_event > events;
+         std::atomic< std::uint64_t > dropped = 0;
+         std::atomic< bool > closed = false;
+
+         // protects the file, held by whoever drains the events
+         std::mutex file_mutex;
+         std::ofstream file;
+         std::string buffer;
+         bool first = true;
+
+         chrome_trace_data( const std::filesystem::path& path, const std::size_t buffer_size )
+            : events( buffer_size ),
+              file( path, std::ios::binary | std::ios::trunc )
+         {
+            if( !file ) {
+               throw std::runtime_error( std::format( "unable to open {}", path.string() ) );
+            }
+            buffer = "{\"traceEvents\":[";
+         }
+
+         // called with the file mutex held
+         void write()
+         {
+            file.write( buffer.data(), static_cast< std::streamsize >( buffer.size() ) );
+            buffer.clear();
+         }
+
+         // called with the file mutex held
+         void append( const chrome_trace_event& e )
+         {
+            buffer += first ? "\n" : ",\n";
+            first = false;
+            buffer += "{\"name\":";
+            internal::append_json( buffer, ( e.name != nullptr ) ? std::string_view( e.name ) : event_name( e.statement ) );
+            std::format_to( std::back_inserter( buffer ), ",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{},\"args\":{{\"connection\":{}", e.category, us( e.start - epoch ), us( e.end - e.start ), e.thread, e.connection );
+            if( e.name == nullptr ) {
+               buffer += ",\"statement\":";
+               internal::append_json( buffer, e.statement );
+               std::format_to( std::back_inserter( buffer ), ",\"send_us\":{:.3f},\"wait_us\":{:.3f},\"decode_us\":{:.3f},\"status\":\"{}\"", us( e.send ), us( e.wait ), us( e.decode ), PQresStatus( e.status ) );
+            }
+            buffer += "}}";
+         }
+
+         // called with the file mutex held
+         void drain()
+         {
+            chrome_trace_event e;
+            while( events.try_pop( e ) ) {
+               append( e );
+               if( buffer.size() >= flush_size ) {
+                  write();
+               }
+            }
+            write();
+         }
+
+         // called with the file mutex held, after the writer thread stopped
+         void close()
+         {
+            drain();
+            buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+            write();
+            file.close();
+         }
+
+         // never blocks
+         void event( chrome_trace_event&& e )
+         {
+            if( closed.load( std::memory_order_relaxed ) ) {
+               return;
+            }
+            e.thread = thread_id();
+            if( !events.try_push( std::move( e ) ) ) {
+               dropped.fetch_add( 1, std::memory_order_relaxed );
+            }
+         }
+
+         void event( const char* name, const char* category, const clock::time_point start, const clock::time_point end, const int connection )
+         {
+            chrome_trace_event e;
+            e.name = name;
+            e.category = category;
+            e.start = start;
+            e.end = end;
+            e.connection = connection;
+            event( std::move( e ) );
+         }
+
+         void pipeline_sync( const connection& c )
+         {
+            const auto now = clock::now();
+            connections.update( c, [ & ]( connection_state& s ) {
+               s.syncs.push_back( now );
+            } );
+         }
+
+         void acquire( const connection& c, const clock::duration duration )
+         {
+            const auto now = clock::now();
+            event( "acquire", "pool", now - duration, now, PQbackendPID( c.underlying_raw_ptr() ) );
+         }
+
+         [[nodiscard]] auto v_sent( const connection& /*unused*/, const char* statement, const int /*unused*/, const char* const* /*unused*/, const int* /*unused*/, const int* /*unused*/ ) -> std::string override
+         {
+            return statement;
+         }
+
+         void v_completed( const connection& c, const PGresult* result, tracked* t, const clock::time_point now ) override
+         {
+            const auto status = PQresultStatus( result );
+            const auto pid = PQbackendPID( c.underlying_raw_ptr() );
+            if( t != nullptr ) {
+               chrome_trace_event e;
+               e.category = "query";
+               e.start = t->start;
+               e.end = now;
+               e.connection = pid;
+               e.statement = std::move( t->payload );
+               e.send = t->sent - t->start;
+               e.wait = t->received - t->sent;
+               e.decode = now - t->received;
+               e.status = status;
+               event( std::move( e ) );
+            }
+
+            const auto transaction_status = PQtransactionStatus( c.underlying_raw_ptr() );
+            connections.update( c, [ & ]( connection_state& s ) {
+               if( status == PGRES_PIPELINE_SYNC ) {
+                  if( !s.syncs.empty() ) {
+                     event( "pipeline sync", "pipeline", s.syncs.front(), now, pid );
+                     s.syncs.pop_front();
+                  }
+               }
+               else if( t != nullptr ) {
+                  switch( status ) {
+                     case PGRES_COPY_IN:
+                     case PGRES_COPY_OUT:
+                     case PGRES_COPY_BOTH:
+                        s.copy = now;
+                        break;
+
+                     default:;
+                  }
+               }
+               else if( s.copy ) {
+                  // the result after COPY
+                  event( "COPY", "copy", *s.copy, now, pid );
+                  s.copy.reset();
+               }
+
+               switch( transaction_status ) {
+                  case PQTRANS_IDLE:
+                     if( s.transaction ) {
+                        event( "transaction", "transaction", *s.transaction, now, pid );
+                        s.transaction.reset();
+                     }
+                     break;
+
+                  case PQTRANS_INTRANS:
+                  case PQTRANS_INERROR:
+                     if( !s.transaction ) {
+                        s.transaction = ( t != nullptr ) ? t->start : now;
+                     }
+                     break;
+
+                  default:;
+               }
+            } );
+         }
+      };
+
+   }  // namespace internal
+
+   chrome_trace::chrome_trace( const std::filesystem::path& path, const std::size_t buffer_size )
+      : m_data( std::make_shared< internal::chrome_trace_data >( path, buffer_size ) ),
+        m_writer( flush_interval, [ d = m_data ] {
+           const std::lock_guard lock( d->file_mutex );
+           d->drain();
+        } )
+   {
+      internal::chrome_trace_data::install( *m_log, m_data );
+      const auto d = m_data;
+      m_log->connection_pool.acquire = [ d ]( const connection_pool& /*unused*/, connection& c, const clock::duration duration ) {
+         d->acquire( c, duration );
+      };
+      m_log->connection.pipeline_sync = [ d ]( connection& c ) {
+         d->pipeline_sync( c );
+      };
+   }
+
+   chrome_trace::~chrome_trace()
+   {
+      m_data->closed = true;
+      m_writer.stop();
+      try {
+         const std::lock_guard lock( m_data->file_mutex );
+         m_data->close();
+      }
+      // LCOV_EXCL_START
+      catch( ... ) {  // NOLINT(bugprone-empty-catch)
+      }
+      // LCOV_EXCL_STOP
+   }
+
+   void chrome_trace::flush()
+   {
+      const std::lock_guard lock( m_data->file_mutex );
+      m_data->drain();
+      m_data->file.flush();
+   }
+
+   auto chrome_trace::dropped() const noexcept -> std::uint64_t
+   {
+      return m_data->dropped.load( std::memory_order_relaxed );
+   }
+
+}  // namespace tao::pq
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <cstdint>
 #include <cstring>
 #include <format>
 #include <functional>
@@ -22,17 +23,52 @@
 #include <tao/pq/access_mode.hpp>
 #include <tao/pq/connection_status.hpp>
 #include <tao/pq/exception.hpp>
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/poll.hpp>
+#include <tao/pq/internal/trace.hpp>
 #include <tao/pq/internal/unreachable.hpp>
 #include <tao/pq/isolation_level.hpp>
 #include <tao/pq/notification.hpp>
 #include <tao/pq/oid.hpp>
 #include <tao/pq/poll.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/trace.hpp>
 #include <tao/pq/transaction_status.hpp>
 
 namespace tao::pq
 {
+   namespace
+   {
+      // only binary parameters have a known length, text parameters would need another scan
+      [[nodiscard]] auto params_size( const int n_params, const char* const values[], const int lengths[], const int formats[] ) noexcept -> std::uint64_t
+      {
+         std::uint64_t size = 0;
+         if( formats != nullptr ) {
+            for( int i = 0; i != n_params; ++i ) {
+               if( ( values[ i ] != nullptr ) && ( formats[ i ] != 0 ) ) {
+                  size += static_cast< std::uint64_t >( lengths[ i ] );
+               }
+            }
+         }
+         return size;
+      }
+
+      // the trailer of a binary COPY is a message of its own, or follows the header of an empty result,
+      // text and CSV rows always end with a newline and are never mistaken for it
+      [[nodiscard]] auto is_binary_copy_trailer( std::string_view data ) noexcept -> bool
+      {
+         if( ( data.size() >= 19 ) && ( data.substr( 0, 11 ) == std::string_view( "PGCOPY\n\377\r\n\0", 11 ) ) ) {
+            const auto extension = internal::from_big_endian< std::uint32_t >( data.data() + 15 );
+            if( data.size() - 19 < extension ) {
+               return false;
+            }
+            data.remove_prefix( 19 + extension );
+         }
+         return data == std::string_view( "\377\377", 2 );
+      }
+
+   }  // namespace
+
    namespace internal
    {
       class transaction_base
@@ -214,43 +250,32 @@ namespace tao::pq
                                  const int formats[] )
    {
       const auto is_prepared = m_prepared_statements.contains( statement );
-      if( m_log ) {
-         if( is_prepared ) {
-            if( m_log->connection.send_query_prepared ) {
-               m_log->connection.send_query_prepared( *this, statement, n_params, values, lengths, formats );
-            }
-         }
-         else {
-            if( m_log->connection.send_query ) {
-               m_log->connection.send_query( *this, statement, n_params, types, values, lengths, formats );
-            }
-         }
+      if( is_prepared ) {
+         internal::trace< trace_point::connection_send_query_prepared >( m_log, *this, statement, n_params, values, lengths, formats );
       }
+      else {
+         internal::trace< trace_point::connection_send_query >( m_log, *this, statement, n_params, types, values, lengths, formats );
+      }
+      const auto result_format = static_cast< int >( m_result_format );
       const auto result = is_prepared ?
-                             PQsendQueryPrepared( m_pgconn.get(), statement, n_params, values, lengths, formats, 0 ) :
-                             PQsendQueryParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, 0 );
-      if( m_log ) {
-         if( is_prepared ) {
-            if( m_log->connection.send_query_prepared.result ) {
-               m_log->connection.send_query_prepared.result( *this, result );
-            }
-         }
-         else {
-            if( m_log->connection.send_query.result ) {
-               m_log->connection.send_query.result( *this, result );
-            }
-         }
+                             PQsendQueryPrepared( m_pgconn.get(), statement, n_params, values, lengths, formats, result_format ) :
+                             PQsendQueryParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, result_format );
+      if( is_prepared ) {
+         internal::trace< trace_point::connection_send_query_prepared_result >( m_log, *this, result );
+      }
+      else {
+         internal::trace< trace_point::connection_send_query_result >( m_log, *this, result );
       }
       if( result == 0 ) {
          throw pq::connection_error( error_message() );  // LCOV_EXCL_LINE
       }
+      m_counters.statement_sent( std::strlen( statement ) + params_size( n_params, values, lengths, formats ) );
    }
 
    void connection::wait( const bool wait_for_write, const std::chrono::steady_clock::time_point end )
    {
-      if( m_log && m_log->connection.wait ) {
-         m_log->connection.wait( *this, wait_for_write, end );
-      }
+      internal::trace< trace_point::connection_wait >( m_log, *this, wait_for_write, end );
+      const auto start = std::chrono::steady_clock::now();
       while( true ) {
          int timeout_ms = -1;
          if( m_timeout ) {
@@ -258,13 +283,13 @@ namespace tao::pq
          }
 
          const auto so = socket();
-         if( m_log && m_log->connection.poll ) {
-            m_log->connection.poll( *this, so, wait_for_write, timeout_ms );
-         }
+         internal::trace< trace_point::connection_poll >( m_log, *this, so, wait_for_write, timeout_ms );
          const auto status = m_poll( so, wait_for_write, timeout_ms );
-         if( m_log && m_log->connection.poll.result ) {
-            m_log->connection.poll.result( *this, so, status );
+         m_counters.poll_wakeup();
+         if( status != poll::status::again ) {  // all other states leave the loop
+            m_counters.waited( std::chrono::steady_clock::now() - start );
          }
+         internal::trace< trace_point::connection_poll_result >( m_log, *this, so, status );
          switch( status ) {
             case poll::status::timeout:
                m_pgconn.reset();
@@ -301,11 +326,15 @@ namespace tao::pq
 
    auto connection::get_result( const std::chrono::steady_clock::time_point end ) -> std::unique_ptr< PGresult, decltype( &PQclear ) >
    {
-      if( m_log && m_log->connection.get_result ) {
-         m_log->connection.get_result( *this, end );
-      }
+      internal::trace< trace_point::connection_get_result >( m_log, *this, end );
       bool wait_for_write = true;
+      bool waited = false;
       while( is_busy() ) {
+         // a result that has to be waited for counts as one round trip
+         if( !waited ) {
+            m_counters.round_trip();
+            waited = true;
+         }
          if( wait_for_write ) {
             wait_for_write = flush();
          }
@@ -313,8 +342,9 @@ namespace tao::pq
       }
 
       std::unique_ptr< PGresult, decltype( &PQclear ) > result( PQgetResult( m_pgconn.get() ), &PQclear );
-      if( m_log && m_log->connection.get_result.result ) {
-         m_log->connection.get_result.result( *this, result.get() );
+      internal::trace< trace_point::connection_get_result_result >( m_log, *this, result.get() );
+      if( result ) {
+         m_counters.result_received( static_cast< std::uint64_t >( PQntuples( result.get() ) ), static_cast< std::uint64_t >( PQresultMemorySize( result.get() ) ) );
       }
       handle_notifications();
       return result;
@@ -348,7 +378,9 @@ namespace tao::pq
       while( true ) {
          const auto result = PQgetCopyData( m_pgconn.get(), &buffer, 1 );
          if( result > 0 ) {
-            return static_cast< std::size_t >( result );
+            const auto size = static_cast< std::size_t >( result );
+            m_counters.copy_received( size, !is_binary_copy_trailer( std::string_view( buffer, size ) ) );
+            return size;
          }
          switch( result ) {
             case 0:
@@ -380,6 +412,7 @@ namespace tao::pq
       while( true ) {
          switch( PQputCopyData( m_pgconn.get(), buffer, static_cast< int >( size ) ) ) {
             case 1:
+               m_counters.copy_sent( size );
                return;
 
                // LCOV_EXCL_START
@@ -494,9 +527,7 @@ namespace tao::pq
    void connection::enter_pipeline_mode()
    {
       const auto result = PQenterPipelineMode( m_pgconn.get() );
-      if( m_log && m_log->connection.enter_pipeline_mode.result ) {
-         m_log->connection.enter_pipeline_mode.result( *this, result );
-      }
+      internal::trace< trace_point::connection_enter_pipeline_mode_result >( m_log, *this, result );
       if( result == 0 ) {
          throw pq::connection_error( "unable to enter pipeline mode" );
       }
@@ -504,13 +535,9 @@ namespace tao::pq
 
    void connection::exit_pipeline_mode()
    {
-      if( m_log && m_log->connection.exit_pipeline_mode ) {
-         m_log->connection.exit_pipeline_mode( *this );
-      }
+      internal::trace< trace_point::connection_exit_pipeline_mode >( m_log, *this );
       const auto result = PQexitPipelineMode( m_pgconn.get() );
-      if( m_log && m_log->connection.exit_pipeline_mode.result ) {
-         m_log->connection.exit_pipeline_mode.result( *this, result );
-      }
+      internal::trace< trace_point::connection_exit_pipeline_mode_result >( m_log, *this, result );
       if( result == 0 ) {
          throw pq::connection_error( error_message() );
       }
@@ -518,13 +545,9 @@ namespace tao::pq
 
    void connection::pipeline_sync()
    {
-      if( m_log && m_log->connection.pipeline_sync ) {
-         m_log->connection.pipeline_sync( *this );
-      }
+      internal::trace< trace_point::connection_pipeline_sync >( m_log, *this );
       const auto result = PQpipelineSync( m_pgconn.get() );
-      if( m_log && m_log->connection.pipeline_sync.result ) {
-         m_log->connection.pipeline_sync.result( *this, result );
-      }
+      internal::trace< trace_point::connection_pipeline_sync_result >( m_log, *this, result );
       if( result == 0 ) {
          throw pq::connection_error( "unable to sync pipeline" );
       }
@@ -533,21 +556,15 @@ namespace tao::pq
    auto connection::is_busy() const noexcept -> bool
    {
       const auto result = PQisBusy( m_pgconn.get() );
-      if( m_log && m_log->connection.is_busy.result ) {
-         m_log->connection.is_busy.result( *this, result );
-      }
+      internal::trace< trace_point::connection_is_busy_result >( m_log, *this, result );
       return result != 0;
    }
 
    auto connection::flush() -> bool
    {
-      if( m_log && m_log->connection.flush ) {
-         m_log->connection.flush( *this );
-      }
+      internal::trace< trace_point::connection_flush >( m_log, *this );
       const auto result = PQflush( m_pgconn.get() );
-      if( m_log && m_log->connection.flush.result ) {
-         m_log->connection.flush.result( *this, result );
-      }
+      internal::trace< trace_point::connection_flush_result >( m_log, *this, result );
       switch( result ) {
          case 0:
             return false;
@@ -562,13 +579,9 @@ namespace tao::pq
 
    void connection::consume_input()
    {
-      if( m_log && m_log->connection.consume_input ) {
-         m_log->connection.consume_input( *this );
-      }
+      internal::trace< trace_point::connection_consume_input >( m_log, *this );
       const auto result = PQconsumeInput( m_pgconn.get() );
-      if( m_log && m_log->connection.consume_input.result ) {
-         m_log->connection.consume_input.result( *this, result );
-      }
+      internal::trace< trace_point::connection_consume_input_result >( m_log, *this, result );
       if( result == 0 ) {
          throw pq::connection_error( error_message() );
       }
@@ -607,6 +620,7 @@ namespace tao::pq
       if( PQsendPrepare( m_pgconn.get(), name.c_str(), statement, 0, nullptr ) == 0 ) {
          throw pq::connection_error( error_message() );  // LCOV_EXCL_LINE
       }
+      m_counters.statement_sent( name.size() + std::strlen( statement ) );
 
       const auto result = connection::get_result( end );
       switch( PQresultStatus( result.get() ) ) {
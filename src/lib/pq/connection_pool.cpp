@@ -4,17 +4,47 @@
 
 #include <tao/pq/connection_pool.hpp>
 
+#include <chrono>
 #include <memory>
 #include <string_view>
 
 #include <tao/pq/connection.hpp>
 #include <tao/pq/internal/poll.hpp>
+#include <tao/pq/internal/trace.hpp>
+#include <tao/pq/trace.hpp>
 
 namespace tao::pq
 {
    auto connection_pool::v_create() const -> std::unique_ptr< pq::connection >
    {
-      return std::make_unique< pq::connection >( pq::connection::private_key(), m_connection_info );
+      const auto start = std::chrono::steady_clock::now();
+      auto result = std::make_unique< pq::connection >( pq::connection::private_key(), m_connection_info );
+      internal::trace< trace_point::connection_pool_create >( m_log, *this, *result, std::chrono::steady_clock::now() - start );
+      return result;
+   }
+
+   void connection_pool::v_returned( pq::connection& c ) const noexcept
+   {
+      internal::trace< trace_point::connection_pool_release >( m_log, *this, c );
+   }
+
+   void connection_pool::v_pushed() const noexcept
+   {
+      log_counts();
+   }
+
+   void connection_pool::v_discarded( pq::connection& c ) const noexcept
+   {
+      internal::trace< trace_point::connection_pool_discard >( m_log, *this, c );
+      log_counts();
+   }
+
+   void connection_pool::log_counts() const noexcept
+   {
+      // avoid locking the pool when no one is listening
+      if( internal::trace_active< trace_point::connection_pool_counts >( m_log ) ) {
+         internal::trace< trace_point::connection_pool_counts >( m_log, *this, size(), attached() );
+      }
    }
 
    connection_pool::connection_pool( const private_key /*unused*/, const std::string_view connection_info )
@@ -24,6 +54,7 @@ namespace tao::pq
 
    auto connection_pool::connection() -> std::shared_ptr< pq::connection >
    {
+      const auto start = std::chrono::steady_clock::now();
       auto result = internal::pool< pq::connection >::get();
       if( m_timeout ) {
          result->set_timeout( *m_timeout );
@@ -31,7 +62,11 @@ namespace tao::pq
       else {
          result->reset_timeout();
       }
+      result->reset_result_format();
       result->set_poll_callback( m_poll );
+      result->set_log_handler( m_log );
+      internal::trace< trace_point::connection_pool_acquire >( m_log, *this, *result, std::chrono::steady_clock::now() - start );
+      log_counts();
       return result;
    }
 
@@ -0,0 +1,23 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/internal/chained_log.hpp>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/log.hpp>
+
+namespace tao::pq::internal
+{
+   void chained_log::attach( pq::connection& connection ) const
+   {
+      connection.set_log_handler( pq::chain( connection.log_handler(), m_log ) );
+   }
+
+   void chained_log::attach( pq::connection_pool& pool ) const
+   {
+      pool.set_log_handler( pq::chain( pool.log_handler(), m_log ) );
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,102 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#endif
+
+#include <tao/pq/internal/copy_scan.hpp>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      // returns true once the newline was found
+      [[nodiscard]] auto scan_one( const char* data, const std::size_t offset, std::vector< std::size_t >& positions, bool& escaped ) -> bool
+      {
+         switch( data[ offset ] ) {
+            case '\t':
+               positions.push_back( offset );
+               return false;
+
+            case '\\':
+               positions.push_back( offset );
+               escaped = true;
+               return false;
+
+            case '\n':
+               positions.push_back( offset );
+               return true;
+
+            default:
+               return false;
+         }
+      }
+
+#if defined( __AVX2__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+      [[nodiscard]] auto scan_mask( const char* data, const std::size_t offset, std::uint32_t mask, std::vector< std::size_t >& positions, bool& escaped ) -> bool
+      {
+         while( mask != 0 ) {
+            if( scan_one( data, offset + std::countr_zero( mask ), positions, escaped ) ) {
+               return true;
+            }
+            mask &= mask - 1;
+         }
+         return false;
+      }
+#endif
+
+   }  // namespace
+
+   auto scan_copy_row( const char* data, const std::size_t size, std::vector< std::size_t >& positions ) -> bool
+   {
+      bool escaped = false;
+      std::size_t i = 0;
+
+#if defined( __AVX2__ )
+      {
+         const __m256i tab = _mm256_set1_epi8( '\t' );
+         const __m256i backslash = _mm256_set1_epi8( '\\' );
+         const __m256i newline = _mm256_set1_epi8( '\n' );
+         for( ; i + 32 <= size; i += 32 ) {
+            const __m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( data + i ) );
+            const __m256i m = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( v, tab ), _mm256_cmpeq_epi8( v, backslash ) ), _mm256_cmpeq_epi8( v, newline ) );
+            if( scan_mask( data, i, static_cast< std::uint32_t >( _mm256_movemask_epi8( m ) ), positions, escaped ) ) {
+               return escaped;
+            }
+         }
+      }
+#endif
+
+#if defined( __AVX2__ ) || defined( __SSE2__ ) || defined( _M_X64 )
+      {
+         const __m128i tab = _mm_set1_epi8( '\t' );
+         const __m128i backslash = _mm_set1_epi8( '\\' );
+         const __m128i newline = _mm_set1_epi8( '\n' );
+         for( ; i + 16 <= size; i += 16 ) {
+            const __m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i* >( data + i ) );
+            const __m128i m = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, tab ), _mm_cmpeq_epi8( v, backslash ) ), _mm_cmpeq_epi8( v, newline ) );
+            if( scan_mask( data, i, static_cast< std::uint32_t >( _mm_movemask_epi8( m ) ), positions, escaped ) ) {
+               return escaped;
+            }
+         }
+      }
+#endif
+
+      for( ; i != size; ++i ) {
+         if( scan_one( data, i, positions, escaped ) ) {
+            break;
+         }
+      }
+      return escaped;
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,48 @@
+// Copyright (c) 2023-2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/internal/errno.hpp>
+
+#include <cstring>
+#include <format>
+#include <string>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      // LCOV_EXCL_START
+      [[nodiscard, maybe_unused]] auto errno_result_to_string( const int e, char* buffer, int result ) -> std::string
+      {
+         if( result == 0 ) {
+            return buffer;
+         }
+         return std::format( "unknown error code {}", e );
+      }
+
+      [[nodiscard, maybe_unused]] auto errno_result_to_string( const int /*unused*/, char* /*unused*/, char* result ) -> std::string
+      {
+         return result;
+      }
+      // LCOV_EXCL_STOP
+
+   }  // namespace
+
+   // LCOV_EXCL_START
+   auto errno_to_string( const int e ) -> std::string
+   {
+      char buffer[ 256 ];
+#if defined( _WIN32 )
+#ifdef _MSC_VER
+      return errno_result_to_string( e, buffer, strerror_s( buffer, e ) );
+#else
+      return errno_result_to_string( e, buffer, strerror_s( buffer, sizeof( buffer ), e ) );
+#endif
+#else
+      return errno_result_to_string( e, buffer, strerror_r( e, buffer, sizeof( buffer ) ) );
+#endif
+   }
+   // LCOV_EXCL_STOP
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/internal/json.hpp>
+
+#include <string>
+#include <string_view>
+
+namespace tao::pq::internal
+{
+   void append_json( std::string& s, const std::string_view value )
+   {
+      static constexpr const char* hex = "0123456789abcdef";
+      s += '"';
+      for( const char c : value ) {
+         switch( c ) {
+            case '"':
+               s += "\\\"";
+               break;
+            case '\\':
+               s += "\\\\";
+               break;
+            case '\n':
+               s += "\\n";
+               break;
+            case '\r':
+               s += "\\r";
+               break;
+            case '\t':
+               s += "\\t";
+               break;
+            default:
+               if( const auto b = static_cast< unsigned char >( c ); b < 0x20 ) {
+                  s += "\\u00";
+                  s += hex[ b >> 4 ];
+                  s += hex[ b & 15 ];
+               }
+               else {
+                  s += c;
+               }
+         }
+      }
+      s += '"';
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,92 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/internal/mapped_file.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+
+#if defined( _WIN32 )
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <tao/pq/internal/errno.hpp>
+
+namespace tao::pq::internal
+{
+#if defined( _WIN32 )
+
+   mapped_file::mapped_file( const std::filesystem::path& path )
+   {
+      std::ifstream stream( path, std::ios::binary );
+      if( !stream ) {
+         throw std::runtime_error( std::format( "failed to open file '{}'", path.string() ) );
+      }
+      m_buffer.assign( std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() );
+      if( stream.bad() ) {
+         throw std::runtime_error( std::format( "failed to read file '{}'", path.string() ) );
+      }
+      m_data = m_buffer.data();
+      m_size = m_buffer.size();
+   }
+
+   mapped_file::~mapped_file() = default;
+
+#else
+
+   mapped_file::mapped_file( const std::filesystem::path& path )
+   {
+      const int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );  // NOLINT(cppcoreguidelines-pro-type-vararg)
+      if( fd < 0 ) {
+         const int e = errno;
+         throw std::runtime_error( std::format( "open() failed for file '{}': {}", path.string(), errno_to_string( e ) ) );
+      }
+
+      struct stat st = {};
+      if( ::fstat( fd, &st ) != 0 ) {
+         const int e = errno;                                                                                                   // LCOV_EXCL_LINE
+         ::close( fd );                                                                                                         // LCOV_EXCL_LINE
+         throw std::runtime_error( std::format( "fstat() failed for file '{}': {}", path.string(), errno_to_string( e ) ) );  // LCOV_EXCL_LINE
+      }
+      if( !S_ISREG( st.st_mode ) ) {
+         ::close( fd );
+         throw std::runtime_error( std::format( "not a regular file '{}'", path.string() ) );
+      }
+      m_size = static_cast< std::size_t >( st.st_size );
+
+      // mmap() does not support empty mappings
+      if( m_size != 0 ) {
+         void* p = ::mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+         const int e = errno;
+         ::close( fd );
+         if( p == MAP_FAILED ) {
+            throw std::runtime_error( std::format( "mmap() failed for file '{}': {}", path.string(), errno_to_string( e ) ) );  // LCOV_EXCL_LINE
+         }
+         ::madvise( p, m_size, MADV_SEQUENTIAL );
+         m_data = static_cast< const char* >( p );
+      }
+      else {
+         ::close( fd );
+      }
+   }
+
+   mapped_file::~mapped_file()
+   {
+      if( m_data != nullptr ) {
+         ::munmap( const_cast< char* >( m_data ), m_size );  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      }
+   }
+
+#endif
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/internal/periodic_thread.hpp>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace tao::pq::internal
+{
+   periodic_thread::periodic_thread( const std::chrono::milliseconds interval, std::function< void() > f )
+      : m_thread( [ this, interval, f = std::move( f ) ] {
+           std::unique_lock lock( m_mutex );
+           bool last = false;
+           while( !last ) {
+              m_cv.wait_for( lock, interval, [ this ] { return m_stop; } );
+              last = m_stop;
+              lock.unlock();
+              try {
+                 f();
+              }
+              // LCOV_EXCL_START
+              catch( ... ) {  // NOLINT(bugprone-empty-catch)
+              }
+              // LCOV_EXCL_STOP
+              lock.lock();
+           }
+        } )
+   {}
+
+   periodic_thread::~periodic_thread()
+   {
+      stop();
+   }
+
+   void periodic_thread::stop() noexcept
+   {
+      {
+         const std::lock_guard lock( m_mutex );
+         m_stop = true;
+      }
+      m_cv.notify_all();
+      if( m_thread.joinable() ) {
+         m_thread.join();
+      }
+   }
+
+}  // namespace tao::pq::internal
@@ -4,11 +4,8 @@
 
 #include <tao/pq/internal/poll.hpp>
 
-#include <cctype>
 #include <cerrno>
-#include <cstring>
 #include <format>
-#include <string>
 
 #if defined( _WIN32 )
 #include <winsock2.h>
@@ -17,44 +14,12 @@
 #endif
 
 #include <tao/pq/exception.hpp>
+#include <tao/pq/internal/errno.hpp>
 #include <tao/pq/internal/unreachable.hpp>
 #include <tao/pq/poll.hpp>
 
 namespace tao::pq::internal
 {
-   namespace
-   {
-      // LCOV_EXCL_START
-      [[nodiscard, maybe_unused]] auto errno_result_to_string( const int e, char* buffer, int result ) -> std::string
-      {
-         if( result == 0 ) {
-            return buffer;
-         }
-         return std::format( "unknown error code {}", e );
-      }
-
-      [[nodiscard, maybe_unused]] auto errno_result_to_string( const int /*unused*/, char* /*unused*/, char* result ) -> std::string
-      {
-         return result;
-      }
-
-      [[nodiscard]] auto errno_to_string( const int e ) -> std::string
-      {
-         char buffer[ 256 ];
-#if defined( _WIN32 )
-#ifdef _MSC_VER
-         return errno_result_to_string( e, buffer, strerror_s( buffer, e ) );
-#else
-         return errno_result_to_string( e, buffer, strerror_s( buffer, sizeof( buffer ), e ) );
-#endif
-#else
-         return errno_result_to_string( e, buffer, strerror_r( e, buffer, sizeof( buffer ) ) );
-#endif
-      }
-      // LCOV_EXCL_STOP
-
-   }  // namespace
-
    auto poll( const int socket, const bool wait_for_write, const int timeout_ms ) -> pq::poll::status
    {
 #if defined( _WIN32 )
@@ -105,7 +70,7 @@ namespace tao::pq::internal
          case -1: {
             const int e = errno;
             if( ( e != EINTR ) && ( e != EAGAIN ) ) {
-               throw network_error( std::format( "poll() failed: ", errno_to_string( e ) ) );
+               throw network_error( std::format( "poll() failed: {}", errno_to_string( e ) ) );
             }
             return pq::poll::status::again;
          }
@@ -4,15 +4,20 @@
 
 #include <tao/pq/large_object.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <filesystem>
 #include <format>
+#include <fstream>
 #include <ios>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <utility>
 
 #include <libpq-fe.h>
@@ -20,8 +25,13 @@
 
 #include <tao/pq/binary.hpp>
 #include <tao/pq/connection.hpp>
+#include <tao/pq/exception.hpp>
+#include <tao/pq/internal/mapped_file.hpp>
 #include <tao/pq/internal/resize_uninitialized.hpp>
 #include <tao/pq/oid.hpp>
+#include <tao/pq/pipeline.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/transaction.hpp>
 
 namespace tao::pq
@@ -33,6 +43,58 @@ namespace tao::pq
          return ( ( ( m & std::ios_base::in ) != 0 ) ? INV_READ : 0 ) | ( ( ( m & std::ios_base::out ) != 0 ) ? INV_WRITE : 0 );
       }
 
+      // the number of chunks that are sent before the first result is awaited
+      constexpr std::size_t pipeline_depth = 4;
+
+      void check_chunk_size( const std::size_t chunk_size )
+      {
+         if( ( chunk_size == 0 ) || ( chunk_size > INT_MAX ) ) {
+            throw std::invalid_argument( std::format( "invalid chunk size {}", chunk_size ) );
+         }
+      }
+
+      // without a flush request the server would hold back the results until the final sync
+      void send_flush_request( connection& connection )
+      {
+         if( PQsendFlushRequest( connection.underlying_raw_ptr() ) == 0 ) {
+            throw pq::connection_error( connection.error_message() );  // LCOV_EXCL_LINE
+         }
+      }
+
+      // results after a failed chunk are aborted, they have no rows
+      [[nodiscard]] auto check_chunk( pq::result&& result ) -> pq::result
+      {
+         if( result.size() != 1 ) {
+            throw std::runtime_error( "large object pipeline aborted" );  // LCOV_EXCL_LINE
+         }
+         return std::move( result );
+      }
+
+      class result_format_guard final
+      {
+      private:
+         connection& m_connection;
+         const pq::result_format m_previous;
+
+      public:
+         result_format_guard( connection& connection, const pq::result_format rf ) noexcept
+            : m_connection( connection ),
+              m_previous( connection.result_format() )
+         {
+            m_connection.set_result_format( rf );
+         }
+
+         ~result_format_guard()
+         {
+            m_connection.set_result_format( m_previous );
+         }
+
+         result_format_guard( const result_format_guard& ) = delete;
+         result_format_guard( result_format_guard&& ) = delete;
+         void operator=( const result_format_guard& ) = delete;
+         void operator=( result_format_guard&& ) = delete;
+      };
+
    }  // namespace
 
    auto large_object::create( const std::shared_ptr< transaction >& transaction, const oid desired_id ) -> oid
@@ -67,6 +129,131 @@ namespace tao::pq
       }
    }
 
+   void large_object::abort_pipeline( const std::shared_ptr< transaction >& transaction, pipeline& pipeline, const bool synced ) noexcept
+   {
+      // consume all pending results up to the final sync, so the connection can leave pipeline mode
+      try {
+         auto& connection = *transaction->connection();
+         if( !connection.is_open() ) {
+            return;  // LCOV_EXCL_LINE
+         }
+         if( !synced ) {
+            connection.pipeline_sync();
+         }
+         const auto end = connection.timeout_end();
+         while( connection.is_open() ) {
+            const auto result = connection.get_result( end );
+            if( result && ( PQresultStatus( result.get() ) == PGRES_PIPELINE_SYNC ) ) {
+               break;
+            }
+         }
+         pipeline.finish();
+      }
+      // LCOV_EXCL_START
+      catch( ... ) {  // NOLINT(bugprone-empty-catch)
+         // the original exception is more important
+      }
+      // LCOV_EXCL_STOP
+   }
+
+   auto large_object::import_file( const std::shared_ptr< transaction >& transaction, const std::filesystem::path& path, const std::size_t chunk_size, const oid desired_id ) -> oid
+   {
+      check_chunk_size( chunk_size );
+      const internal::mapped_file file( path );
+      const oid id = large_object::create( transaction, desired_id );
+      large_object lo( transaction, id, std::ios_base::out );
+
+      const auto chunks = ( file.size() + chunk_size - 1 ) / chunk_size;
+      const auto chunk = [ & ]( const std::size_t i ) {
+         return binary_view( reinterpret_cast< const std::byte* >( file.data() + ( i * chunk_size ) ), std::min( chunk_size, file.size() - ( i * chunk_size ) ) );
+      };
+      const auto receive = [ & ]( pq::pipeline& pipeline, const std::size_t i ) {
+         if( check_chunk( pipeline.get_result() ).as< std::size_t >() != chunk( i ).size() ) {
+            throw std::runtime_error( "tao::pq::large_object::import_file() failed: incomplete write" );  // LCOV_EXCL_LINE
+         }
+      };
+
+      const auto pipeline = transaction->pipeline();
+      bool synced = false;
+      try {
+         for( std::size_t i = 0; i != chunks; ++i ) {
+            pipeline->send( "SELECT pg_catalog.lowrite( $1, $2 )", lo.m_fd, chunk( i ) );
+            send_flush_request( *transaction->connection() );
+            if( i >= pipeline_depth ) {
+               receive( *pipeline, i - pipeline_depth );
+            }
+         }
+         pipeline->sync();
+         synced = true;
+         for( std::size_t i = ( chunks > pipeline_depth ) ? ( chunks - pipeline_depth ) : 0; i != chunks; ++i ) {
+            receive( *pipeline, i );
+         }
+         pipeline->consume_sync();
+         pipeline->finish();
+      }
+      catch( ... ) {
+         abort_pipeline( transaction, *pipeline, synced );
+         throw;
+      }
+      lo.close();
+      return id;
+   }
+
+   void large_object::export_file( const std::shared_ptr< transaction >& transaction, const oid id, const std::filesystem::path& path, const std::size_t chunk_size )
+   {
+      check_chunk_size( chunk_size );
+      large_object lo( transaction, id, std::ios_base::in );
+      const auto size = static_cast< std::size_t >( lo.seek( 0, std::ios_base::end ) );
+      std::ignore = lo.seek( 0, std::ios_base::beg );
+
+      std::ofstream stream( path, std::ios_base::binary | std::ios_base::trunc );
+      if( !stream ) {
+         throw std::runtime_error( std::format( "tao::pq::large_object::export_file() failed to open file '{}'", path.string() ) );
+      }
+
+      const auto chunks = ( size + chunk_size - 1 ) / chunk_size;
+      const auto receive = [ & ]( pq::pipeline& pipeline, const std::size_t i ) {
+         const auto result = check_chunk( pipeline.get_result() );
+         const auto* const pgresult = result.underlying_raw_ptr();
+         const auto length = static_cast< std::size_t >( PQgetlength( pgresult, 0, 0 ) );
+         if( length != std::min( chunk_size, size - ( i * chunk_size ) ) ) {
+            throw std::runtime_error( "tao::pq::large_object::export_file() failed: incomplete read" );  // LCOV_EXCL_LINE
+         }
+         stream.write( PQgetvalue( pgresult, 0, 0 ), static_cast< std::streamsize >( length ) );
+      };
+
+      // bytea in binary format is the raw data
+      const result_format_guard guard( *transaction->connection(), result_format::binary_format );
+      const auto pipeline = transaction->pipeline();
+      bool synced = false;
+      try {
+         for( std::size_t i = 0; i != chunks; ++i ) {
+            pipeline->send( "SELECT pg_catalog.loread( $1, $2 )", lo.m_fd, static_cast< int >( chunk_size ) );
+            send_flush_request( *transaction->connection() );
+            if( i >= pipeline_depth ) {
+               receive( *pipeline, i - pipeline_depth );
+            }
+         }
+         pipeline->sync();
+         synced = true;
+         for( std::size_t i = ( chunks > pipeline_depth ) ? ( chunks - pipeline_depth ) : 0; i != chunks; ++i ) {
+            receive( *pipeline, i );
+         }
+         pipeline->consume_sync();
+         pipeline->finish();
+      }
+      catch( ... ) {
+         abort_pipeline( transaction, *pipeline, synced );
+         throw;
+      }
+      lo.close();
+
+      stream.close();
+      if( !stream ) {
+         throw std::runtime_error( std::format( "tao::pq::large_object::export_file() failed to write file '{}'", path.string() ) );
+      }
+   }
+
    large_object::large_object( const std::shared_ptr< transaction >& transaction, const oid id, const std::ios_base::openmode m )
       : m_transaction( transaction ),
         m_fd( lo_open( transaction->connection()->underlying_raw_ptr(), static_cast< Oid >( id ), to_mode( m ) ) )
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/large_object_streambuf.hpp>
+
+#include <cstddef>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <tao/pq/internal/resize_uninitialized.hpp>
+#include <tao/pq/large_object.hpp>
+#include <tao/pq/oid.hpp>
+
+namespace tao::pq
+{
+   large_object_streambuf::large_object_streambuf( large_object&& object, const std::size_t buffer_size )
+      : m_large_object( std::move( object ) ),
+        m_buffer_size( buffer_size )
+   {
+      if( buffer_size == 0 ) {
+         throw std::invalid_argument( "invalid buffer size 0" );
+      }
+   }
+
+   large_object_streambuf::large_object_streambuf( const std::shared_ptr< transaction >& transaction, const oid id, const std::ios_base::openmode m, const std::size_t buffer_size )
+      : large_object_streambuf( large_object( transaction, id, m ), buffer_size )
+   {}
+
+   large_object_streambuf::~large_object_streambuf()
+   {
+      try {
+         if( m_open ) {
+            write_buffer();
+         }
+      }
+      // LCOV_EXCL_START
+      catch( ... ) {  // NOLINT(bugprone-empty-catch)
+         // call close() to see errors
+      }
+      // LCOV_EXCL_STOP
+   }
+
+   void large_object_streambuf::write_buffer()
+   {
+      if( pptr() != pbase() ) {
+         m_large_object.write( pbase(), static_cast< std::size_t >( pptr() - pbase() ) );
+      }
+      // the next write goes through overflow() which discards the read-ahead
+      setp( nullptr, nullptr );
+   }
+
+   // the server's position is ahead of ours by the number of unread bytes
+   void large_object_streambuf::discard_read_ahead()
+   {
+      if( gptr() != egptr() ) {
+         std::ignore = m_large_object.seek( gptr() - egptr(), std::ios_base::cur );
+      }
+      setg( nullptr, nullptr, nullptr );
+   }
+
+   auto large_object_streambuf::underflow() -> int_type
+   {
+      if( gptr() != egptr() ) {
+         return traits_type::to_int_type( *gptr() );
+      }
+      if( !m_open ) {
+         return traits_type::eof();
+      }
+      write_buffer();
+      if( m_get.empty() ) {
+         internal::resize_uninitialized( m_get, m_buffer_size );
+      }
+      const auto size = m_large_object.read( m_get.data(), m_get.size() );
+      if( size == 0 ) {
+         setg( nullptr, nullptr, nullptr );
+         return traits_type::eof();
+      }
+      setg( m_get.data(), m_get.data(), m_get.data() + size );
+      return traits_type::to_int_type( *gptr() );
+   }
+
+   auto large_object_streambuf::overflow( const int_type c ) -> int_type
+   {
+      if( !m_open ) {
+         return traits_type::eof();
+      }
+      discard_read_ahead();
+      write_buffer();
+      if( m_put.empty() ) {
+         internal::resize_uninitialized( m_put, m_buffer_size );
+      }
+      setp( m_put.data(), m_put.data() + m_put.size() );
+      if( !traits_type::eq_int_type( c, traits_type::eof() ) ) {
+         *pptr() = traits_type::to_char_type( c );
+         pbump( 1 );
+      }
+      return traits_type::not_eof( c );
+   }
+
+   auto large_object_streambuf::xsputn( const char_type* s, const std::streamsize n ) -> std::streamsize
+   {
+      // data that does not fit into the remaining buffer is coalesced with the buffer's
+      // content, large writes bypass the buffer instead of being split into several writes
+      if( m_open && ( static_cast< std::size_t >( n ) >= m_buffer_size ) ) {
+         discard_read_ahead();
+         write_buffer();
+         m_large_object.write( s, static_cast< std::size_t >( n ) );
+         return n;
+      }
+      return std::streambuf::xsputn( s, n );
+   }
+
+   auto large_object_streambuf::sync() -> int
+   {
+      if( m_open ) {
+         write_buffer();
+      }
+      return 0;
+   }
+
+   auto large_object_streambuf::seekoff( off_type off, const std::ios_base::seekdir dir, const std::ios_base::openmode /*unused*/ ) -> pos_type
+   {
+      if( !m_open ) {
+         return pos_type( off_type( -1 ) );
+      }
+      // tellg() and tellp() must not discard the buffers
+      if( ( dir == std::ios_base::cur ) && ( off == 0 ) ) {
+         return pos_type( m_large_object.tell() - ( egptr() - gptr() ) + ( pptr() - pbase() ) );
+      }
+      write_buffer();
+      if( dir == std::ios_base::cur ) {
+         off -= egptr() - gptr();
+      }
+      setg( nullptr, nullptr, nullptr );
+      return pos_type( m_large_object.seek( off, dir ) );
+   }
+
+   auto large_object_streambuf::seekpos( const pos_type pos, const std::ios_base::openmode which ) -> pos_type
+   {
+      return seekoff( off_type( pos ), std::ios_base::beg, which );
+   }
+
+   void large_object_streambuf::close()
+   {
+      if( m_open ) {
+         write_buffer();
+         m_open = false;
+         setg( nullptr, nullptr, nullptr );
+         m_large_object.close();
+      }
+   }
+
+}  // namespace tao::pq
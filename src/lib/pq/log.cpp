@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/log.hpp>
+
+#include <memory>
+
+namespace tao::pq
+{
+   namespace
+   {
+      // the hooks are looked up on each call, later changes to existing hooks are therefore visible
+      template< typename Select >
+      void chain_hook( log& target, const std::shared_ptr< log >& first, const std::shared_ptr< log >& second, const Select select )
+      {
+         if( !select( *first ) && !select( *second ) ) {
+            return;
+         }
+         select( target ) = [ first, second, select ]( auto&&... as ) {
+            if( const auto& hook = select( *first ) ) {
+               hook( as... );
+            }
+            if( const auto& hook = select( *second ) ) {
+               hook( as... );
+            }
+         };
+      }
+
+   }  // namespace
+
+   auto chain( const std::shared_ptr< log >& first, const std::shared_ptr< log >& second ) -> std::shared_ptr< log >
+   {
+      if( !first || ( first == second ) ) {
+         return second;
+      }
+      if( !second ) {
+         return first;
+      }
+      auto result = std::make_shared< log >();
+      auto& r = *result;
+
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection_pool.acquire; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection_pool.create; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection_pool.release; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection_pool.discard; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection_pool.counts; } );
+
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::send_query_t& { return l.connection.send_query; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.send_query.result; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::send_query_prepared_t& { return l.connection.send_query_prepared; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.send_query_prepared.result; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.wait; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::poll_t& { return l.connection.poll; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.poll.result; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.is_busy.result; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::consume_input_t& { return l.connection.consume_input; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.consume_input.result; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::flush_t& { return l.connection.flush; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.flush.result; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::get_result_t& { return l.connection.get_result; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.get_result.result; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.enter_pipeline_mode.result; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::exit_pipeline_mode_t& { return l.connection.exit_pipeline_mode; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.exit_pipeline_mode.result; } );
+      chain_hook( r, first, second, []( log& l ) -> log::connection_t::pipeline_sync_t& { return l.connection.pipeline_sync; } );
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.connection.pipeline_sync.result; } );
+
+      chain_hook( r, first, second, []( log& l ) -> auto& { return l.transaction.destructor_rollback_failed; } );
+
+      return result;
+   }
+
+}  // namespace tao::pq
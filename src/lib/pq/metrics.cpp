@@ -0,0 +1,277 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/metrics.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/internal/statement_tracker.hpp>
+
+namespace tao::pq
+{
+   auto latency_histogram::snapshot::percentile( const double p ) const noexcept -> std::chrono::nanoseconds
+   {
+      if( m_count == 0 ) {
+         return std::chrono::nanoseconds( 0 );
+      }
+      const auto rank = std::max< std::uint64_t >( static_cast< std::uint64_t >( std::ceil( std::clamp( p, 0.0, 100.0 ) / 100.0 * static_cast< double >( m_count ) ) ), 1 );
+      std::uint64_t seen = 0;
+      for( const auto& [ index, count ] : m_counts ) {
+         seen += count;
+         if( seen >= rank ) {
+            return std::chrono::nanoseconds( std::min( latency_histogram::upper_bound( index ), m_max ) );
+         }
+      }
+      return std::chrono::nanoseconds( m_max );  // LCOV_EXCL_LINE
+   }
+
+   auto latency_histogram::snapshot::buckets() const -> std::vector< std::pair< std::chrono::nanoseconds, std::uint64_t > >
+   {
+      std::vector< std::pair< std::chrono::nanoseconds, std::uint64_t > > result;
+      result.reserve( m_counts.size() );
+      for( const auto& [ index, count ] : m_counts ) {
+         result.emplace_back( std::chrono::nanoseconds( latency_histogram::upper_bound( index ) ), count );
+      }
+      return result;
+   }
+
+   void latency_histogram::record( const std::chrono::nanoseconds duration ) noexcept
+   {
+      const auto ns = static_cast< std::uint64_t >( std::max< std::chrono::nanoseconds::rep >( duration.count(), 0 ) );
+      m_counts[ latency_histogram::index( ns ) ].fetch_add( 1, std::memory_order_relaxed );
+      m_sum.fetch_add( ns, std::memory_order_relaxed );
+      auto max = m_max.load( std::memory_order_relaxed );
+      while( ( ns > max ) && !m_max.compare_exchange_weak( max, ns, std::memory_order_relaxed ) ) {
+      }
+   }
+
+   auto latency_histogram::get_snapshot() const -> snapshot
+   {
+      snapshot result;
+      for( std::size_t i = 0; i != buckets; ++i ) {
+         if( const auto count = m_counts[ i ].load( std::memory_order_relaxed ); count != 0 ) {
+            result.m_counts.emplace_back( i, count );
+            result.m_count += count;
+         }
+      }
+      result.m_sum = m_sum.load( std::memory_order_relaxed );
+      result.m_max = m_max.load( std::memory_order_relaxed );
+      return result;
+   }
+
+   void latency_histogram::reset() noexcept
+   {
+      for( auto& count : m_counts ) {
+         count.store( 0, std::memory_order_relaxed );
+      }
+      m_sum.store( 0, std::memory_order_relaxed );
+      m_max.store( 0, std::memory_order_relaxed );
+   }
+
+   namespace internal
+   {
+      struct statement_metrics
+      {
+         std::atomic< std::uint64_t > errors = 0;
+         latency_histogram send;
+         latency_histogram wait;
+         latency_histogram decode;
+         latency_histogram total;
+      };
+
+      struct metrics_data final
+         : statement_tracker< statement_metrics* >
+      {
+         // the text of a statement together with its hash, which is only calculated once per lookup
+         struct statement_key
+         {
+            std::string_view text;
+            std::size_t hash;
+
+            explicit statement_key( const std::string_view t ) noexcept
+               : text( t ),
+                 hash( std::hash< std::string_view >()( t ) )
+            {}
+         };
+
+         struct statement_hash
+         {
+            using is_transparent = void;
+
+            [[nodiscard]] auto operator()( const std::string& s ) const noexcept -> std::size_t
+            {
+               return std::hash< std::string_view >()( s );
+            }
+
+            [[nodiscard]] auto operator()( const statement_key& k ) const noexcept -> std::size_t
+            {
+               return k.hash;
+            }
+         };
+
+         struct statement_equal
+         {
+            using is_transparent = void;
+
+            [[nodiscard]] auto operator()( const std::string& lhs, const std::string& rhs ) const noexcept -> bool
+            {
+               return lhs == rhs;
+            }
+
+            [[nodiscard]] auto operator()( const statement_key& lhs, const std::string& rhs ) const noexcept -> bool
+            {
+               return lhs.text == rhs;
+            }
+
+            [[nodiscard]] auto operator()( const std::string& lhs, const statement_key& rhs ) const noexcept -> bool
+            {
+               return lhs == rhs.text;
+            }
+         };
+
+         // entries are never removed, so pending statements can refer to them
+         struct alignas( 64 ) shard
+         {
+            mutable std::shared_mutex mutex;
+            std::unordered_map< std::string, std::unique_ptr< statement_metrics >, statement_hash, statement_equal > statements;
+         };
+
+         const std::size_t max_statements;
+         const statement_key other_key{ metrics::other_statements };
+
+         std::array< shard, 16 > shards;
+         std::atomic< std::size_t > size = 0;
+
+         explicit metrics_data( const std::size_t max )
+            : max_statements( max )
+         {}
+
+         // returns nullptr if the statement is new and the maximum number of statements is reached
+         [[nodiscard]] auto find( const statement_key& key, const bool limited ) -> statement_metrics*
+         {
+            auto& s = shards[ key.hash % shards.size() ];
+            {
+               const std::shared_lock lock( s.mutex );
+               if( const auto it = s.statements.find( key ); it != s.statements.end() ) {
+                  return it->second.get();
+               }
+            }
+            if( limited && ( size.load( std::memory_order_relaxed ) >= max_statements ) ) {
+               return nullptr;
+            }
+            const std::unique_lock lock( s.mutex );
+            auto it = s.statements.find( key );
+            if( it == s.statements.end() ) {
+               if( limited && ( size.fetch_add( 1, std::memory_order_relaxed ) >= max_statements ) ) {
+                  size.fetch_sub( 1, std::memory_order_relaxed );
+                  return nullptr;
+               }
+               it = s.statements.emplace( key.text, std::make_unique< statement_metrics >() ).first;
+            }
+            return it->second.get();
+         }
+
+         template< typename F >
+         void for_each( const F& f ) const
+         {
+            for( const auto& s : shards ) {
+               const std::shared_lock lock( s.mutex );
+               for( const auto& [ statement, m ] : s.statements ) {
+                  f( statement, *m );
+               }
+            }
+         }
+
+         [[nodiscard]] auto v_sent( const connection& /*unused*/, const char* statement, const int /*unused*/, const char* const* /*unused*/, const int* /*unused*/, const int* /*unused*/ ) -> statement_metrics* override
+         {
+            if( auto* const s = find( statement_key( statement ), true ) ) {
+               return s;
+            }
+            return find( other_key, false );
+         }
+
+         void v_failed( const connection& /*unused*/, tracked& t ) override
+         {
+            t.payload->errors.fetch_add( 1, std::memory_order_relaxed );
+         }
+
+         void v_completed( const connection& /*unused*/, const PGresult* result, tracked* t, const clock::time_point now ) override
+         {
+            if( t == nullptr ) {
+               return;
+            }
+            auto& s = *t->payload;
+            s.send.record( t->sent - t->start );
+            s.wait.record( t->received - t->sent );
+            s.decode.record( now - t->received );
+            s.total.record( now - t->start );
+            switch( PQresultStatus( result ) ) {
+               case PGRES_BAD_RESPONSE:
+               case PGRES_NONFATAL_ERROR:
+               case PGRES_FATAL_ERROR:
+               case PGRES_PIPELINE_ABORTED:
+                  s.errors.fetch_add( 1, std::memory_order_relaxed );
+                  break;
+
+               default:;
+            }
+         }
+      };
+
+   }  // namespace internal
+
+   metrics::metrics( const std::size_t max_statements )
+      : m_data( std::make_shared< internal::metrics_data >( max_statements ) )
+   {
+      internal::metrics_data::install( *m_log, m_data );
+   }
+
+   auto metrics::snapshot() const -> std::vector< statement_snapshot >
+   {
+      std::vector< statement_snapshot > result;
+      result.reserve( m_data->size.load( std::memory_order_relaxed ) + 1 );
+      m_data->for_each( [ & ]( const std::string& statement, const internal::statement_metrics& s ) {
+         auto& r = result.emplace_back();
+         r.statement = statement;
+         r.errors = s.errors.load( std::memory_order_relaxed );
+         r.send = s.send.get_snapshot();
+         r.wait = s.wait.get_snapshot();
+         r.decode = s.decode.get_snapshot();
+         r.total = s.total.get_snapshot();
+         r.count = r.total.count();
+      } );
+      std::ranges::sort( result, {}, &statement_snapshot::statement );
+      return result;
+   }
+
+   void metrics::reset()
+   {
+      m_data->for_each( []( const std::string& /*unused*/, internal::statement_metrics& s ) {
+         s.errors.store( 0, std::memory_order_relaxed );
+         s.send.reset();
+         s.wait.reset();
+         s.decode.reset();
+         s.total.reset();
+      } );
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,207 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/parallel_table_writer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/commit_mode.hpp>
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/table_writer.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      constexpr std::size_t commit_prepared_attempts = 3;
+
+      // global transaction identifiers for PREPARE TRANSACTION, must be unique across sessions
+      [[nodiscard]] auto gid_prefix() -> std::string
+      {
+         std::random_device rd;
+         const auto high = static_cast< std::uint64_t >( rd() );
+         const auto low = static_cast< std::uint64_t >( rd() );
+         return std::format( "taopq_{:08x}{:08x}", high & 0xffffffff, low & 0xffffffff );
+      }
+
+   }  // namespace
+
+   void parallel_table_writer::rollback() noexcept
+   {
+      for( auto& s : m_shards ) {
+         s.writer.reset();
+         s.transaction.reset();  // rolls back an open transaction
+         if( s.connection && !s.gid.empty() ) {
+            try {
+               std::ignore = s.connection->execute( std::format( "ROLLBACK PREPARED '{}'", s.gid ) );
+            }
+            catch( ... ) {  // NOLINT(bugprone-empty-catch)
+            }
+         }
+      }
+      m_shards.clear();
+   }
+
+   auto parallel_table_writer::commit_prepared( shard_data& s ) noexcept -> bool
+   {
+      try {
+         const auto statement = std::format( "COMMIT PREPARED '{}'", s.gid );
+         for( std::size_t attempt = 0; attempt != commit_prepared_attempts; ++attempt ) {
+            try {
+               // a prepared transaction can be committed from any session, so retry on a new connection
+               if( attempt != 0 ) {
+                  s.connection.reset();
+                  s.connection = m_pool->connection();
+               }
+               std::ignore = s.connection->execute( statement );
+               return true;
+            }
+            catch( ... ) {  // NOLINT(bugprone-empty-catch)
+            }
+         }
+      }
+      // LCOV_EXCL_START
+      catch( ... ) {  // NOLINT(bugprone-empty-catch)
+      }
+      // LCOV_EXCL_STOP
+      return false;
+   }
+
+   parallel_table_writer::parallel_table_writer( const std::shared_ptr< connection_pool >& pool, const std::size_t connections, const internal::zsv statement, const pq::commit_mode cm )
+      : m_pool( pool ),
+        m_commit_mode( cm )
+   {
+      if( connections == 0 ) {
+         throw std::invalid_argument( "parallel_table_writer requires at least one connection" );
+      }
+      m_shards.reserve( connections );
+      try {
+         for( std::size_t i = 0; i != connections; ++i ) {
+            auto& s = m_shards.emplace_back();
+            s.connection = m_pool->connection();
+            s.transaction = s.connection->transaction();
+            s.writer = std::make_unique< table_writer >( s.transaction, statement );
+         }
+      }
+      catch( ... ) {
+         rollback();
+         throw;
+      }
+   }
+
+   parallel_table_writer::~parallel_table_writer()
+   {
+      rollback();
+   }
+
+   auto parallel_table_writer::shard( const std::size_t index ) -> table_writer&
+   {
+      if( m_shards.empty() ) {
+         throw std::logic_error( "parallel_table_writer already committed" );
+      }
+      return *m_shards.at( index ).writer;
+   }
+
+   void parallel_table_writer::set_flush_threshold( const std::size_t threshold )
+   {
+      for( auto& s : m_shards ) {
+         s.writer->set_flush_threshold( threshold );
+      }
+   }
+
+   void parallel_table_writer::insert_raw( const std::string_view data )
+   {
+      shard( m_next ).insert_raw( data );
+      m_next = ( m_next + 1 ) % m_shards.size();
+   }
+
+   void parallel_table_writer::flush()
+   {
+      for( auto& s : m_shards ) {
+         s.writer->flush();
+      }
+   }
+
+   auto parallel_table_writer::commit() -> std::size_t
+   {
+      if( m_shards.empty() ) {
+         throw std::logic_error( "parallel_table_writer already committed" );
+      }
+      std::size_t rows = 0;
+      try {
+         // send everything first, so that all backends keep working while we wait for the results
+         flush();
+
+         for( auto& s : m_shards ) {
+            s.rows = s.writer->commit();
+            s.writer.reset();
+            rows += s.rows;
+         }
+
+         if( m_commit_mode == pq::commit_mode::independent ) {
+            std::vector< std::size_t > committed;
+            std::size_t committed_rows = 0;
+            for( std::size_t i = 0; i != m_shards.size(); ++i ) {
+               auto& s = m_shards[ i ];
+               try {
+                  s.transaction->commit();
+               }
+               catch( const std::exception& e ) {
+                  if( committed.empty() ) {
+                     throw;
+                  }
+                  // the earlier shards can not be rolled back anymore
+                  throw partial_commit_error( std::format( "COMMIT failed for shard {} after {} of {} shards with {} rows were committed: {}", i, committed.size(), m_shards.size(), committed_rows, e.what() ), std::move( committed ), committed_rows );
+               }
+               s.transaction.reset();
+               committed.push_back( i );
+               committed_rows += s.rows;
+            }
+            m_shards.clear();
+            return rows;
+         }
+
+         const auto prefix = gid_prefix();
+         for( std::size_t i = 0; i != m_shards.size(); ++i ) {
+            auto& s = m_shards[ i ];
+            auto gid = std::format( "{}_{}", prefix, i );
+            std::ignore = s.transaction->execute( std::format( "PREPARE TRANSACTION '{}'", gid ) );
+            s.gid = std::move( gid );
+            s.transaction.reset();  // the session is idle now, nothing to roll back
+         }
+      }
+      catch( ... ) {
+         rollback();
+         throw;
+      }
+
+      // all transactions are prepared, from here on they may only be committed, never rolled back
+      auto shards = std::move( m_shards );
+      m_shards.clear();
+      std::vector< std::string > outstanding;
+      for( auto& s : shards ) {
+         if( !commit_prepared( s ) ) {
+            outstanding.push_back( s.gid );
+         }
+      }
+      if( !outstanding.empty() ) {
+         throw prepared_commit_error( std::format( "COMMIT PREPARED failed for {} of {} prepared transactions", outstanding.size(), shards.size() ), std::move( outstanding ) );
+      }
+      return rows;
+   }
+
+}  // namespace tao::pq
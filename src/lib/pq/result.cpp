@@ -97,6 +97,22 @@ namespace tao::pq
       return column;
    }
 
+   auto result::format( const std::size_t column ) const -> result_format
+   {
+      if( column >= m_columns ) {
+         throw std::out_of_range( std::format( "column {} out of range (0-{})", column, m_columns - 1 ) );
+      }
+      return static_cast< result_format >( PQfformat( m_pgresult.get(), static_cast< int >( column ) ) );
+   }
+
+   auto result::type( const std::size_t column ) const -> oid
+   {
+      if( column >= m_columns ) {
+         throw std::out_of_range( std::format( "column {} out of range (0-{})", column, m_columns - 1 ) );
+      }
+      return static_cast< oid >( PQftype( m_pgresult.get(), static_cast< int >( column ) ) );
+   }
+
    auto result::begin() const noexcept -> result::const_iterator
    {
       assert( m_columns != 0 );
@@ -125,6 +141,14 @@ namespace tao::pq
       return PQgetvalue( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) );
    }
 
+   auto result::length( const std::size_t row, const std::size_t column ) const -> std::size_t
+   {
+      if( is_null( row, column ) ) {
+         throw std::runtime_error( std::format( "unexpected NULL value in row {} column {}/'{}'", row, column, name( column ) ) );
+      }
+      return PQgetlength( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) );
+   }
+
    auto result::at( const std::size_t row ) const -> pq::row
    {
       check_row( row );
@@ -5,12 +5,16 @@
 #include <tao/pq/result_traits.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <format>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include <tao/pq/binary.hpp>
+#include <tao/pq/internal/demangle.hpp>
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/from_chars.hpp>
 #include <tao/pq/internal/resize_uninitialized.hpp>
 #include <tao/pq/internal/strtox.hpp>
@@ -54,6 +58,51 @@ namespace tao::pq
          return nrv;
       }
 
+      template< typename T >
+      [[nodiscard]] auto from_binary_integral( const char* value, const std::size_t size ) -> T
+      {
+         std::int64_t result = 0;
+         switch( size ) {
+            case 1:
+               result = static_cast< signed char >( value[ 0 ] );
+               break;
+
+            case 2:
+               result = internal::from_big_endian< std::int16_t >( value );
+               break;
+
+            case 4:
+               result = internal::from_big_endian< std::int32_t >( value );
+               break;
+
+            case 8:
+               result = internal::from_big_endian< std::int64_t >( value );
+               break;
+
+            default:
+               throw std::invalid_argument( std::format( "invalid binary size {} in tao::pq::result_traits<{}>", size, internal::demangle< T >() ) );
+         }
+         if( !std::in_range< T >( result ) ) {
+            throw std::out_of_range( std::format( "binary value {} out of range in tao::pq::result_traits<{}>", result, internal::demangle< T >() ) );
+         }
+         return static_cast< T >( result );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto from_binary_floating_point( const char* value, const std::size_t size ) -> T
+      {
+         switch( size ) {
+            case 4:
+               return static_cast< T >( internal::from_big_endian< float >( value ) );
+
+            case 8:
+               return static_cast< T >( internal::from_big_endian< double >( value ) );
+
+            default:
+               throw std::invalid_argument( std::format( "invalid binary size {} in tao::pq::result_traits<{}>", size, internal::demangle< T >() ) );
+         }
+      }
+
    }  // namespace
 
    auto result_traits< bool >::from( const char* value ) -> bool
@@ -69,6 +118,19 @@ namespace tao::pq
       throw std::runtime_error( std::format( "invalid value in tao::pq::result_traits<bool> for input: {}", value ) );
    }
 
+   auto result_traits< bool >::from_binary( const char* value, const std::size_t size ) -> bool
+   {
+      if( size == 1 ) {
+         if( value[ 0 ] == 1 ) {
+            return true;
+         }
+         if( value[ 0 ] == 0 ) {
+            return false;
+         }
+      }
+      throw std::runtime_error( "invalid binary value in tao::pq::result_traits<bool>" );
+   }
+
    auto result_traits< char >::from( const char* value ) -> char
    {
       if( ( value[ 0 ] == '\0' ) || ( value[ 1 ] != '\0' ) ) {
@@ -77,74 +139,152 @@ namespace tao::pq
       return value[ 0 ];
    }
 
+   auto result_traits< char >::from_binary( const char* value, const std::size_t size ) -> char
+   {
+      if( size != 1 ) {
+         throw std::runtime_error( std::format( "invalid binary size {} in tao::pq::result_traits<char>", size ) );
+      }
+      return value[ 0 ];
+   }
+
    auto result_traits< signed char >::from( const char* value ) -> signed char
    {
       return internal::from_chars< signed char >( value );
    }
 
+   auto result_traits< signed char >::from_binary( const char* value, const std::size_t size ) -> signed char
+   {
+      return from_binary_integral< signed char >( value, size );
+   }
+
    auto result_traits< unsigned char >::from( const char* value ) -> unsigned char
    {
       return internal::from_chars< unsigned char >( value );
    }
 
+   auto result_traits< unsigned char >::from_binary( const char* value, const std::size_t size ) -> unsigned char
+   {
+      return from_binary_integral< unsigned char >( value, size );
+   }
+
    auto result_traits< short >::from( const char* value ) -> short
    {
       return internal::from_chars< short >( value );
    }
 
+   auto result_traits< short >::from_binary( const char* value, const std::size_t size ) -> short
+   {
+      return from_binary_integral< short >( value, size );
+   }
+
    auto result_traits< unsigned short >::from( const char* value ) -> unsigned short
    {
       return internal::from_chars< unsigned short >( value );
    }
 
+   auto result_traits< unsigned short >::from_binary( const char* value, const std::size_t size ) -> unsigned short
+   {
+      return from_binary_integral< unsigned short >( value, size );
+   }
+
    auto result_traits< int >::from( const char* value ) -> int
    {
       return internal::from_chars< int >( value );
    }
 
+   auto result_traits< int >::from_binary( const char* value, const std::size_t size ) -> int
+   {
+      return from_binary_integral< int >( value, size );
+   }
+
    auto result_traits< unsigned >::from( const char* value ) -> unsigned
    {
       return internal::from_chars< unsigned >( value );
    }
 
+   auto result_traits< unsigned >::from_binary( const char* value, const std::size_t size ) -> unsigned
+   {
+      return from_binary_integral< unsigned >( value, size );
+   }
+
    auto result_traits< long >::from( const char* value ) -> long
    {
       return internal::from_chars< long >( value );
    }
 
+   auto result_traits< long >::from_binary( const char* value, const std::size_t size ) -> long
+   {
+      return from_binary_integral< long >( value, size );
+   }
+
    auto result_traits< unsigned long >::from( const char* value ) -> unsigned long
    {
       return internal::from_chars< unsigned long >( value );
    }
 
+   auto result_traits< unsigned long >::from_binary( const char* value, const std::size_t size ) -> unsigned long
+   {
+      return from_binary_integral< unsigned long >( value, size );
+   }
+
    auto result_traits< long long >::from( const char* value ) -> long long
    {
       return internal::from_chars< long long >( value );
    }
 
+   auto result_traits< long long >::from_binary( const char* value, const std::size_t size ) -> long long
+   {
+      return from_binary_integral< long long >( value, size );
+   }
+
    auto result_traits< unsigned long long >::from( const char* value ) -> unsigned long long
    {
       return internal::from_chars< unsigned long long >( value );
    }
 
+   auto result_traits< unsigned long long >::from_binary( const char* value, const std::size_t size ) -> unsigned long long
+   {
+      return from_binary_integral< unsigned long long >( value, size );
+   }
+
    auto result_traits< float >::from( const char* value ) -> float
    {
       return internal::strtof( value );
    }
 
+   auto result_traits< float >::from_binary( const char* value, const std::size_t size ) -> float
+   {
+      return from_binary_floating_point< float >( value, size );
+   }
+
    auto result_traits< double >::from( const char* value ) -> double
    {
       return internal::strtod( value );
    }
 
+   auto result_traits< double >::from_binary( const char* value, const std::size_t size ) -> double
+   {
+      return from_binary_floating_point< double >( value, size );
+   }
+
    auto result_traits< long double >::from( const char* value ) -> long double
    {
       return internal::strtold( value );
    }
 
+   auto result_traits< long double >::from_binary( const char* value, const std::size_t size ) -> long double
+   {
+      return from_binary_floating_point< long double >( value, size );
+   }
+
    auto result_traits< binary >::from( const char* value ) -> binary
    {
       return unescape_bytea( value );
    }
 
+   auto result_traits< binary >::from_binary( const char* value, const std::size_t size ) -> binary
+   {
+      return pq::to_binary( value, size );
+   }
+
 }  // namespace tao::pq
@@ -4,11 +4,15 @@
 
 #include <tao/pq/result_traits_array.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
 
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/unreachable.hpp>
+#include <tao/pq/oid.hpp>
 
 namespace tao::pq::internal
 {
@@ -45,4 +49,65 @@ namespace tao::pq::internal
       throw std::invalid_argument( "unterminated unquoted string" );
    }
 
+   binary_array_reader::binary_array_reader( const char* value, const std::size_t size )
+      : m_pos( value ),
+        m_end( value + size )
+   {
+      if( size < 12 ) {
+         throw std::invalid_argument( "unexpected end of binary array" );
+      }
+      const auto dimensions = internal::from_big_endian< std::int32_t >( m_pos );
+      const auto flags = internal::from_big_endian< std::int32_t >( m_pos + 4 );
+      m_element = static_cast< oid >( internal::from_big_endian< std::uint32_t >( m_pos + 8 ) );
+      m_pos += 12;
+
+      if( ( dimensions < 0 ) || ( static_cast< std::size_t >( dimensions ) > max_dimensions ) ) {
+         throw std::invalid_argument( "invalid number of binary array dimensions" );
+      }
+      if( ( flags != 0 ) && ( flags != 1 ) ) {
+         throw std::invalid_argument( "invalid binary array flags" );
+      }
+      m_dimensions = static_cast< std::size_t >( dimensions );
+      m_has_null = ( flags == 1 );
+
+      if( static_cast< std::size_t >( m_end - m_pos ) < m_dimensions * 8 ) {
+         throw std::invalid_argument( "unexpected end of binary array" );
+      }
+      for( std::size_t i = 0; i != m_dimensions; ++i ) {
+         const auto n = internal::from_big_endian< std::int32_t >( m_pos );
+         if( n < 0 ) {
+            throw std::invalid_argument( "invalid binary array dimension" );
+         }
+         m_sizes[ i ] = static_cast< std::size_t >( n );
+         m_pos += 8;  // skip lower bound
+      }
+   }
+
+   auto binary_array_reader::next( std::size_t& size ) -> const char*
+   {
+      if( m_end - m_pos < 4 ) {
+         throw std::invalid_argument( "unexpected end of binary array" );
+      }
+      const auto length = internal::from_big_endian< std::int32_t >( m_pos );
+      m_pos += 4;
+      if( length == -1 ) {
+         size = 0;
+         return nullptr;
+      }
+      if( ( length < 0 ) || ( m_end - m_pos < length ) ) {
+         throw std::invalid_argument( "unexpected end of binary array" );
+      }
+      const char* value = m_pos;
+      m_pos += length;
+      size = static_cast< std::size_t >( length );
+      return value;
+   }
+
+   void binary_array_reader::finish() const
+   {
+      if( m_pos != m_end ) {
+         throw std::invalid_argument( "unexpected additional data" );
+      }
+   }
+
 }  // namespace tao::pq::internal
@@ -60,6 +60,20 @@ namespace tao::pq
       throw std::out_of_range( std::format( "column not found: {}", static_cast< const char* >( in_name ) ) );
    }
 
+   auto row::format( const std::size_t column ) const -> result_format
+   {
+      ensure_column( column );
+      assert( m_result );
+      return m_result->format( m_offset + column );
+   }
+
+   auto row::type( const std::size_t column ) const -> oid
+   {
+      ensure_column( column );
+      assert( m_result );
+      return m_result->type( m_offset + column );
+   }
+
    auto row::begin() const noexcept -> row::const_iterator
    {
       return const_iterator( field( *this, m_offset ) );
@@ -84,6 +98,13 @@ namespace tao::pq
       return m_result->get( m_row, m_offset + column );
    }
 
+   auto row::length( const std::size_t column ) const -> std::size_t
+   {
+      ensure_column( column );
+      assert( m_result );
+      return m_result->length( m_row, m_offset + column );
+   }
+
    auto row::at( const std::size_t column ) const -> field
    {
       ensure_column( column );
@@ -0,0 +1,280 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/slow_query_log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/internal/json.hpp>
+#include <tao/pq/internal/ring_buffer.hpp>
+#include <tao/pq/internal/statement_tracker.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      // parameters are copied unformatted when a statement is sent, each one as a kind,
+      // a size, and the (truncated) data, they are only formatted for recorded statements
+      enum class parameter_kind : char
+      {
+         null,
+         text,
+         text_truncated,
+         binary,
+         binary_truncated
+      };
+
+      void append_parameter( std::string& data, const char* value, const int length, const int format, const std::size_t max )
+      {
+         parameter_kind kind = parameter_kind::null;
+         std::size_t n = 0;
+         if( value != nullptr ) {
+            if( format == 1 ) {
+               const auto size = static_cast< std::size_t >( std::max( length, 0 ) );
+               n = std::min( size, max / 2 );
+               kind = ( n == size ) ? parameter_kind::binary : parameter_kind::binary_truncated;
+            }
+            else {
+               // text parameters are null-terminated, do not look further than necessary
+               while( ( n <= max ) && ( value[ n ] != '\0' ) ) {
+                  ++n;
+               }
+               kind = ( n > max ) ? parameter_kind::text_truncated : parameter_kind::text;
+               n = std::min( n, max );
+            }
+         }
+         const auto size = static_cast< std::uint32_t >( n );
+         data += static_cast< char >( kind );
+         data.append( reinterpret_cast< const char* >( &size ), sizeof( size ) );  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+         if( n != 0 ) {
+            data.append( value, n );
+         }
+      }
+
+      [[nodiscard]] auto format_parameters( std::string_view data ) -> std::vector< std::optional< std::string > >
+      {
+         static constexpr const char* hex = "0123456789abcdef";
+         std::vector< std::optional< std::string > > result;
+         while( !data.empty() ) {
+            const auto kind = static_cast< parameter_kind >( data[ 0 ] );
+            std::uint32_t size;
+            std::memcpy( &size, data.data() + 1, sizeof( size ) );
+            const auto value = data.substr( 1 + sizeof( size ), size );
+            data.remove_prefix( 1 + sizeof( size ) + size );
+            switch( kind ) {
+               case parameter_kind::null:
+                  result.emplace_back( std::nullopt );
+                  break;
+
+               case parameter_kind::text:
+               case parameter_kind::text_truncated:
+                  result.emplace_back( value );
+                  break;
+
+               case parameter_kind::binary:
+               case parameter_kind::binary_truncated: {
+                  auto& s = result.emplace_back( "\\x" ).value();
+                  for( const char c : value ) {
+                     const auto b = static_cast< unsigned char >( c );
+                     s += hex[ b >> 4 ];
+                     s += hex[ b & 15 ];
+                  }
+                  break;
+               }
+            }
+            if( ( kind == parameter_kind::text_truncated ) || ( kind == parameter_kind::binary_truncated ) ) {
+               *result.back() += "...";
+            }
+         }
+         return result;
+      }
+
+      [[nodiscard]] auto sample( const double rate ) -> bool
+      {
+         if( rate <= 0.0 ) {
+            return false;
+         }
+         thread_local std::minstd_rand engine( std::random_device{}() );
+         return std::uniform_real_distribution< double >( 0.0, 1.0 )( engine ) < rate;
+      }
+
+      [[nodiscard]] auto rows_affected( const PGresult* result ) noexcept -> std::uint64_t
+      {
+         const std::string_view str = PQcmdTuples( const_cast< PGresult* >( result ) );  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+         std::uint64_t rows = 0;
+         std::from_chars( str.data(), str.data() + str.size(), rows );
+         return rows;
+      }
+
+   }  // namespace
+
+   auto to_string( const slow_query& query ) -> std::string
+   {
+      const auto days = std::chrono::floor< std::chrono::days >( query.start );
+      const std::chrono::year_month_day ymd( days );
+      const std::chrono::hh_mm_ss time( std::chrono::floor< std::chrono::microseconds >( query.start - days ) );
+      std::string result = std::format( "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:06}Z duration={:.3f}ms pid={} rows={}",
+                                        static_cast< int >( ymd.year() ),
+                                        static_cast< unsigned >( ymd.month() ),
+                                        static_cast< unsigned >( ymd.day() ),
+                                        time.hours().count(),
+                                        time.minutes().count(),
+                                        time.seconds().count(),
+                                        time.subseconds().count(),
+                                        std::chrono::duration< double, std::milli >( query.duration ).count(),
+                                        query.backend_pid,
+                                        query.rows );
+      if( query.error ) {
+         result += " error";
+      }
+      if( query.sampled ) {
+         result += " sampled";
+      }
+      result += " statement=";
+      internal::append_json( result, query.statement );
+      if( !query.parameters.empty() ) {
+         result += " parameters=[";
+         for( std::size_t i = 0; i != query.parameters.size(); ++i ) {
+            if( i != 0 ) {
+               result += ',';
+            }
+            if( query.parameters[ i ] ) {
+               internal::append_json( result, *query.parameters[ i ] );
+            }
+            else {
+               result += "NULL";
+            }
+         }
+         result += ']';
+      }
+      return result;
+   }
+
+   namespace internal
+   {
+      struct slow_query_statement
+      {
+         std::string data;  // the statement followed by the parameters, see append_parameter()
+         std::size_t statement_size = 0;
+         bool sampled = false;
+      };
+
+      struct slow_query_data final
+         : statement_tracker< slow_query_statement >
+      {
+         const slow_query_log::writer_t writer;
+         const slow_query_options options;
+
+         ring_buffer< slow_query > buffer;
+         std::atomic< std::uint64_t > dropped = 0;
+
+         slow_query_data( slow_query_log::writer_t w, const slow_query_options& o )
+            : writer( std::move( w ) ),
+              options( o ),
+              buffer( o.buffer_size )
+         {}
+
+         [[nodiscard]] auto v_sent( const connection& /*unused*/, const char* statement, const int n_params, const char* const values[], const int lengths[], const int formats[] ) -> slow_query_statement override
+         {
+            slow_query_statement s;
+            s.data = statement;
+            s.statement_size = s.data.size();
+            for( int i = 0; i != n_params; ++i ) {
+               append_parameter( s.data, values[ i ], ( lengths != nullptr ) ? lengths[ i ] : 0, ( formats != nullptr ) ? formats[ i ] : 0, options.max_parameter_size );
+            }
+            s.sampled = sample( options.sample_rate );
+            return s;
+         }
+
+         void v_completed( const connection& c, const PGresult* result, tracked* t, const clock::time_point now ) override
+         {
+            if( t == nullptr ) {
+               return;  // e.g. the result after COPY
+            }
+
+            const auto duration = now - t->start;
+            const bool slow = ( duration >= options.threshold );
+            if( !slow && !t->payload.sampled ) {
+               return;
+            }
+
+            slow_query query;
+            query.start = std::chrono::system_clock::now() - std::chrono::duration_cast< std::chrono::system_clock::duration >( duration );
+            query.duration = duration;
+            query.statement.assign( t->payload.data, 0, t->payload.statement_size );
+            query.parameters = format_parameters( std::string_view( t->payload.data ).substr( t->payload.statement_size ) );
+            query.rows = t->rows;
+            query.backend_pid = PQbackendPID( c.underlying_raw_ptr() );
+            query.sampled = !slow;
+
+            switch( PQresultStatus( result ) ) {
+               case PGRES_TUPLES_OK:
+                  query.rows += static_cast< std::uint64_t >( PQntuples( result ) );
+                  break;
+
+               case PGRES_COMMAND_OK:
+                  query.rows = rows_affected( result );
+                  break;
+
+               case PGRES_BAD_RESPONSE:
+               case PGRES_NONFATAL_ERROR:
+               case PGRES_FATAL_ERROR:
+               case PGRES_PIPELINE_ABORTED:
+                  query.error = true;
+                  break;
+
+               default:;
+            }
+
+            if( !buffer.try_push( std::move( query ) ) ) {
+               dropped.fetch_add( 1, std::memory_order_relaxed );
+            }
+         }
+
+         // only called from the writer thread
+         void drain() noexcept
+         {
+            slow_query query;
+            while( buffer.try_pop( query ) ) {
+               try {
+                  writer( query );
+               }
+               catch( ... ) {  // NOLINT(bugprone-empty-catch)
+               }
+            }
+         }
+      };
+
+   }  // namespace internal
+
+   slow_query_log::slow_query_log( writer_t writer, const slow_query_options& options )
+      : m_data( std::make_shared< internal::slow_query_data >( std::move( writer ), options ) ),
+        m_writer( options.flush_interval, [ d = m_data ] { d->drain(); } )
+   {
+      internal::slow_query_data::install( *m_log, m_data );
+   }
+
+   auto slow_query_log::dropped() const noexcept -> std::uint64_t
+   {
+      return m_data->dropped.load( std::memory_order_relaxed );
+   }
+
+}  // namespace tao::pq
@@ -25,4 +25,9 @@ namespace tao::pq
       return m_row->get( m_column );
    }
 
+   auto table_field::length() const -> std::size_t
+   {
+      return m_row->length( m_column );
+   }
+
 }  // namespace tao::pq
@@ -4,22 +4,252 @@
 
 #include <tao/pq/table_reader.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cerrno>
 #include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <deque>
+#include <exception>
+#include <format>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 #include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined( _WIN32 )
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 #include <libpq-fe.h>
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/csv_options.hpp>
 #include <tao/pq/exception.hpp>
+#include <tao/pq/internal/copy_scan.hpp>
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/internal/errno.hpp>
 #include <tao/pq/internal/unreachable.hpp>
 #include <tao/pq/result.hpp>
 
 namespace tao::pq
 {
+   namespace internal
+   {
+      // receives COPY data in a background thread into a bounded queue
+      class copy_read_ahead final
+      {
+      private:
+         struct chunk
+         {
+            std::unique_ptr< char, decltype( &PQfreemem ) > buffer;
+            std::size_t size;
+         };
+
+         const std::function< std::size_t( char*& ) > m_get_copy_data;
+         const std::size_t m_capacity;
+         const std::unique_ptr< PGcancel, decltype( &PQfreeCancel ) > m_cancel;
+
+         std::mutex m_mutex;
+         std::condition_variable m_cv;
+         std::deque< chunk > m_chunks;
+         std::exception_ptr m_error;
+         bool m_done = false;
+         bool m_stop = false;
+
+         std::thread m_thread;
+
+         void run() noexcept
+         {
+            try {
+               while( true ) {
+                  char* buffer = nullptr;
+                  const auto size = m_get_copy_data( buffer );
+                  chunk c{ std::unique_ptr< char, decltype( &PQfreemem ) >( buffer, &PQfreemem ), size };
+
+                  std::unique_lock lock( m_mutex );
+                  if( size == 0 ) {
+                     m_done = true;
+                     m_cv.notify_all();
+                     return;
+                  }
+                  m_cv.wait( lock, [ this ] { return m_stop || ( m_chunks.size() < m_capacity ); } );
+                  if( m_stop ) {
+                     return;
+                  }
+                  m_chunks.emplace_back( std::move( c ) );
+                  m_cv.notify_all();
+               }
+            }
+            catch( ... ) {
+               const std::lock_guard lock( m_mutex );
+               m_error = std::current_exception();
+               m_done = true;
+               m_cv.notify_all();
+            }
+         }
+
+      public:
+         copy_read_ahead( std::function< std::size_t( char*& ) > get_copy_data, const std::size_t capacity, PGconn* pgconn )
+            : m_get_copy_data( std::move( get_copy_data ) ),
+              m_capacity( capacity ),
+              m_cancel( PQgetCancel( pgconn ), &PQfreeCancel ),
+              m_thread( [ this ] { run(); } )
+         {}
+
+         ~copy_read_ahead()
+         {
+            bool done = false;
+            {
+               const std::lock_guard lock( m_mutex );
+               m_stop = true;
+               done = m_done;
+            }
+            m_cv.notify_all();
+            // the thread might be blocked waiting for the server, cancel the COPY so it ends promptly
+            if( !done && m_cancel ) {
+               char buffer[ 256 ];
+               std::ignore = PQcancel( m_cancel.get(), buffer, sizeof( buffer ) );
+            }
+            m_thread.join();
+         }
+
+         copy_read_ahead( const copy_read_ahead& ) = delete;
+         copy_read_ahead( copy_read_ahead&& ) = delete;
+         void operator=( const copy_read_ahead& ) = delete;
+         void operator=( copy_read_ahead&& ) = delete;
+
+         [[nodiscard]] auto get( char*& buffer ) -> std::size_t
+         {
+            std::unique_lock lock( m_mutex );
+            m_cv.wait( lock, [ this ] { return !m_chunks.empty() || m_done; } );
+            if( !m_chunks.empty() ) {
+               auto c = std::move( m_chunks.front() );
+               m_chunks.pop_front();
+               m_cv.notify_all();
+               buffer = c.buffer.release();
+               return c.size;
+            }
+            if( m_error ) {
+               std::rethrow_exception( m_error );
+            }
+            return 0;
+         }
+      };
+
+      void copy_read_ahead_deleter::operator()( copy_read_ahead* p ) const noexcept
+      {
+         delete p;  // NOLINT(cppcoreguidelines-owning-memory)
+      }
+
+      namespace
+      {
+         // collects COPY buffers and writes them with a single writev() per batch
+         class copy_fd_writer final
+         {
+         private:
+#if defined( IOV_MAX )
+            static constexpr std::size_t max_buffers = IOV_MAX;
+#else
+            static constexpr std::size_t max_buffers = 16;  // _XOPEN_IOV_MAX
+#endif
+            static constexpr std::size_t max_bytes = 1024 * 1024;
+
+            const int m_fd;
+            std::vector< std::unique_ptr< char, decltype( &PQfreemem ) > > m_buffers;
+            std::vector< std::string_view > m_data;
+            std::size_t m_size = 0;
+
+            static void write( const int fd, const char* data, std::size_t size )
+            {
+               while( size != 0 ) {
+#if defined( _WIN32 )
+                  const auto n = ::_write( fd, data, static_cast< unsigned >( std::min< std::size_t >( size, INT_MAX ) ) );
+#else
+                  const auto n = ::write( fd, data, size );
+#endif
+                  if( n < 0 ) {
+                     const int e = errno;
+                     if( e == EINTR ) {
+                        continue;  // LCOV_EXCL_LINE
+                     }
+                     throw std::runtime_error( std::format( "write() failed: {}", internal::errno_to_string( e ) ) );
+                  }
+                  data += n;
+                  size -= static_cast< std::size_t >( n );
+               }
+            }
+
+         public:
+            explicit copy_fd_writer( const int fd )
+               : m_fd( fd )
+            {}
+
+            void append( char* buffer, const std::size_t size )
+            {
+               m_buffers.emplace_back( buffer, &PQfreemem );
+               m_data.emplace_back( buffer, size );
+               m_size += size;
+               if( ( m_data.size() == max_buffers ) || ( m_size >= max_bytes ) ) {
+                  flush();
+               }
+            }
+
+            void flush()
+            {
+#if defined( _WIN32 )
+               for( const auto data : m_data ) {
+                  write( m_fd, data.data(), data.size() );
+               }
+#else
+               std::vector< ::iovec > iov;
+               iov.reserve( m_data.size() );
+               for( const auto data : m_data ) {
+                  iov.push_back( { const_cast< char* >( data.data() ), data.size() } );  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+               }
+               std::size_t i = 0;
+               while( i != iov.size() ) {
+                  const auto n = ::writev( m_fd, iov.data() + i, static_cast< int >( iov.size() - i ) );
+                  if( n < 0 ) {
+                     const int e = errno;
+                     if( e == EINTR ) {
+                        continue;  // LCOV_EXCL_LINE
+                     }
+                     throw std::runtime_error( std::format( "writev() failed: {}", internal::errno_to_string( e ) ) );
+                  }
+                  // skip what was written, the rest of a partially written buffer is written directly
+                  auto written = static_cast< std::size_t >( n );
+                  while( ( i != iov.size() ) && ( written >= iov[ i ].iov_len ) ) {
+                     written -= iov[ i++ ].iov_len;
+                  }
+                  if( written != 0 ) {
+                     write( m_fd, static_cast< const char* >( iov[ i ].iov_base ) + written, iov[ i ].iov_len - written );
+                     ++i;
+                  }
+               }
+#endif
+               m_buffers.clear();
+               m_data.clear();
+               m_size = 0;
+            }
+         };
+
+      }  // namespace
+
+   }  // namespace internal
+
    void table_reader::check_result()
    {
       const auto start = std::chrono::steady_clock::now();
@@ -28,6 +258,7 @@ namespace tao::pq
       switch( PQresultStatus( result.get() ) ) {
          case PGRES_COPY_OUT:
             m_columns = PQnfields( result.get() );
+            m_binary = ( PQbinaryTuples( result.get() ) != 0 );
             break;
 
          case PGRES_COPY_IN:
@@ -49,16 +280,115 @@ namespace tao::pq
       }
    }
 
+   auto table_reader::get_copy_data( char*& buffer ) -> std::size_t
+   {
+      if( m_read_ahead == 0 ) {
+         return m_transaction->connection()->get_copy_data( buffer );
+      }
+      if( !m_read_ahead_buffers ) {
+         m_read_ahead_buffers.reset( new internal::copy_read_ahead( [ c = m_transaction->connection() ]( char*& b ) { return c->get_copy_data( b ); }, m_read_ahead, m_transaction->connection()->underlying_raw_ptr() ) );  // NOLINT(cppcoreguidelines-owning-memory)
+      }
+      const auto size = m_read_ahead_buffers->get( buffer );
+      if( size == 0 ) {
+         // the background thread is finished, the connection is ours again
+         m_read_ahead_buffers.reset();
+      }
+      return size;
+   }
+
+   void table_reader::set_read_ahead( const std::size_t rows )
+   {
+      if( m_read_ahead_buffers ) {
+         throw std::logic_error( "read-ahead already active" );
+      }
+      m_read_ahead = rows;
+   }
+
+   void table_reader::set_csv( csv_options options )
+   {
+      if( m_binary ) {
+         throw std::logic_error( "CSV options for binary COPY" );
+      }
+      m_csv = std::move( options );
+   }
+
+   auto table_reader::copy_to_fd( const int fd ) -> copy_to_fd_result
+   {
+      if( m_header || has_data() ) {
+         throw std::logic_error( "COPY data was already read" );
+      }
+      copy_to_fd_result result;
+      if( !m_transaction ) {
+         return result;
+      }
+      m_buffer.reset();
+      m_raw_data = {};
+
+      internal::copy_fd_writer writer( fd );
+      while( true ) {
+         char* buffer = nullptr;
+         const auto size = table_reader::get_copy_data( buffer );
+         if( size == 0 ) {
+            break;
+         }
+         writer.append( buffer, size );
+         result.bytes += size;
+      }
+      writer.flush();
+
+      const auto end = m_transaction->connection()->timeout_end();
+      result.rows = pq::result( m_transaction->connection()->get_result( end ).release() ).rows_affected();
+      m_transaction.reset();
+      m_previous.reset();
+      return result;
+   }
+
    auto table_reader::get_raw_data() -> std::string_view
    {
-      char* buffer = nullptr;
-      const auto size = m_transaction->connection()->get_copy_data( buffer );
-      m_buffer.reset( buffer );
+      // already at the end of the data
+      if( !m_transaction ) {
+         m_buffer.reset();
+         m_raw_data = {};
+         return {};
+      }
 
-      if( size > 0 ) {
-         return { static_cast< const char* >( buffer ), size };
+      while( true ) {
+         char* buffer = nullptr;
+         const auto size = table_reader::get_copy_data( buffer );
+         m_buffer.reset( buffer );
+
+         if( size == 0 ) {
+            break;
+         }
+
+         std::string_view data( static_cast< const char* >( buffer ), size );
+         if( !m_binary ) {
+            m_raw_data = data;
+            return data;
+         }
+
+         // the binary format starts with a header, see PostgreSQL's COPY documentation
+         if( !m_header ) {
+            if( ( data.size() < 19 ) || ( data.substr( 0, 11 ) != std::string_view( "PGCOPY\n\377\r\n\0", 11 ) ) ) {
+               throw std::runtime_error( "invalid binary COPY header" );
+            }
+            const auto extension = internal::from_big_endian< std::uint32_t >( data.data() + 15 );
+            if( data.size() - 19 < extension ) {
+               throw std::runtime_error( "invalid binary COPY header" );
+            }
+            data.remove_prefix( 19 + extension );
+            m_header = true;
+         }
+
+         // skip the trailer, the next call will signal the end of the data
+         if( data.empty() || ( internal::from_big_endian< std::int16_t >( data.data() ) == -1 ) ) {
+            continue;
+         }
+         m_raw_data = data;
+         return data;
       }
 
+      m_raw_data = {};
       const auto end = m_transaction->connection()->timeout_end();
       std::ignore = pq::result( m_transaction->connection()->get_result( end ).release() );
       m_transaction.reset();
@@ -66,18 +396,151 @@ namespace tao::pq
       return {};
    }
 
-   auto table_reader::parse_data() noexcept -> bool
+   auto table_reader::parse_data() -> bool
+   {
+      if( m_binary ) {
+         return parse_binary_data();
+      }
+      return m_csv ? parse_csv_data() : parse_text_data();
+   }
+
+   auto table_reader::parse_csv_data() -> bool
    {
       m_data.clear();
       char* read = m_buffer.get();
       if( read == nullptr ) {
          return false;
       }
-      char* write = read;
-      char* begin = write;
-      while( auto* pos = std::strpbrk( read, "\t\\\n" ) ) {
+      // the CSV options are set separately from the COPY statement and might not match it
+      const char delimiter = m_csv->delimiter;
+      const char quote = m_csv->quote;
+      const char* const end = read + m_raw_data.size();
+      while( true ) {
+         char* const begin = read;
+         char* write = read;
+         if( ( read != end ) && ( *read == quote ) ) {
+            // quoted values are unescaped in place and are never NULL
+            ++read;
+            while( true ) {
+               if( read == end ) {
+                  throw std::runtime_error( "invalid CSV COPY data: unterminated quoted field" );
+               }
+               if( *read == quote ) {
+                  if( ( ++read == end ) || ( *read != quote ) ) {
+                     break;
+                  }
+               }
+               *write++ = *read++;
+            }
+            m_data.emplace_back( begin );
+         }
+         else {
+            while( ( read != end ) && ( *read != delimiter ) && ( *read != '\n' ) ) {
+               ++read;
+            }
+            write = read;
+            m_data.emplace_back( ( std::string_view( begin, read ) == m_csv->null ) ? nullptr : begin );
+         }
+         if( read == end ) {
+            throw std::runtime_error( "invalid CSV COPY data: truncated row" );
+         }
+         const char c = *read++;
+         *write = '\0';
+         if( c == '\n' ) {
+            if( read != end ) {
+               throw std::runtime_error( "invalid CSV COPY data: trailing bytes" );
+            }
+            if( m_data.size() != columns() ) {
+               throw std::runtime_error( std::format( "invalid CSV COPY data: {} fields, expected {}", m_data.size(), columns() ) );
+            }
+            return true;
+         }
+         if( c != delimiter ) {
+            throw std::runtime_error( "invalid CSV COPY data: unexpected character after quoted field" );
+         }
+      }
+   }
+
+   auto table_reader::parse_binary_data() -> bool
+   {
+      m_data.clear();
+      m_lengths.clear();
+      if( !m_buffer ) {
+         return false;
+      }
+      // the data comes from the server, validate it like the header
+      const char* pos = m_raw_data.data();
+      const char* const end = pos + m_raw_data.size();
+      if( end - pos < 2 ) {
+         throw std::runtime_error( "invalid binary COPY data: truncated row" );
+      }
+      const auto fields = internal::from_big_endian< std::int16_t >( pos );
+      pos += 2;
+      if( ( fields < 0 ) || ( static_cast< std::size_t >( fields ) != columns() ) ) {
+         throw std::runtime_error( std::format( "invalid binary COPY data: {} fields, expected {}", fields, columns() ) );
+      }
+      for( std::int16_t i = 0; i != fields; ++i ) {
+         if( end - pos < 4 ) {
+            throw std::runtime_error( "invalid binary COPY data: truncated row" );
+         }
+         const auto length = internal::from_big_endian< std::int32_t >( pos );
+         pos += 4;
+         if( length < 0 ) {
+            m_data.emplace_back( nullptr );
+            m_lengths.emplace_back( 0 );
+         }
+         else {
+            if( end - pos < length ) {
+               throw std::runtime_error( "invalid binary COPY data: truncated field" );
+            }
+            m_data.emplace_back( pos );
+            m_lengths.emplace_back( static_cast< std::size_t >( length ) );
+            pos += length;
+         }
+      }
+      if( pos != end ) {
+         throw std::runtime_error( "invalid binary COPY data: trailing bytes" );
+      }
+      return true;
+   }
+
+   auto table_reader::parse_text_data() noexcept -> bool
+   {
+      m_data.clear();
+      char* const data = m_buffer.get();
+      if( data == nullptr ) {
+         return false;
+      }
+      m_positions.clear();
+      const bool escaped = internal::scan_copy_row( data, m_raw_data.size(), m_positions );
+      assert( !m_positions.empty() );
+      assert( data[ m_positions.back() ] == '\n' );
+
+      // fast path, fields are terminated in place
+      if( !escaped ) {
+         char* begin = data;
+         for( const auto offset : m_positions ) {
+            m_data.emplace_back( begin );
+            data[ offset ] = '\0';
+            begin = data + offset + 1;
+         }
+         assert( m_data.size() == columns() );
+         return true;
+      }
+
+      // escape sequences are unescaped in place, data is only moved after the first one in a field
+      char* read = data;
+      char* write = data;
+      char* begin = data;
+      for( const auto offset : m_positions ) {
+         char* pos = data + offset;
+         if( pos < read ) {
+            continue;  // part of an escape sequence
+         }
          if( const auto prefix_size = pos - read ) {
-            std::memmove( write, read, prefix_size );
+            if( write != read ) {
+               std::memmove( write, read, prefix_size );
+            }
             write += prefix_size;
          }
          switch( *pos ) {
@@ -99,6 +562,7 @@ namespace tao::pq
                            break;
 
                         case '\n':
+                           assert( m_data.size() == columns() );
                            return true;
 
                         default:                         // LCOV_EXCL_LINE
@@ -5,9 +5,11 @@
 #include <tao/pq/table_row.hpp>
 
 #include <cstddef>
+#include <cstring>
 #include <format>
 #include <stdexcept>
 
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/table_reader.hpp>
 
 namespace tao::pq
@@ -40,6 +42,12 @@ namespace tao::pq
       return const_iterator( table_field( *this, m_offset + m_columns ) );
    }
 
+   auto table_row::format( const std::size_t column ) const -> result_format
+   {
+      ensure_column( column );
+      return m_reader->is_binary() ? result_format::binary_format : result_format::text_format;
+   }
+
    auto table_row::is_null( const std::size_t column ) const -> bool
    {
       return get( column ) == nullptr;
@@ -51,6 +59,15 @@ namespace tao::pq
       return m_reader->raw_data()[ m_offset + column ];
    }
 
+   auto table_row::length( const std::size_t column ) const -> std::size_t
+   {
+      const char* const value = get( column );
+      if( value == nullptr ) {
+         throw std::invalid_argument( "unexpected NULL value" );
+      }
+      return m_reader->is_binary() ? m_reader->raw_lengths()[ m_offset + column ] : std::strlen( value );
+   }
+
    auto table_row::at( const std::size_t column ) const -> table_field
    {
       ensure_column( column );
@@ -4,21 +4,215 @@
 
 #include <tao/pq/table_writer.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <functional>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <tuple>
+#include <utility>
 
 #include <libpq-fe.h>
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/csv_options.hpp>
 #include <tao/pq/exception.hpp>
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/internal/mapped_file.hpp>
 #include <tao/pq/result.hpp>
 
 namespace tao::pq
 {
+   namespace internal
+   {
+      void csv_append( std::string& buffer, const std::string_view value, const csv_options& csv )
+      {
+         const char special[] = { csv.delimiter, csv.quote, '\n', '\r' };
+         // an unquoted \. on a line of its own would be taken as the end-of-data marker
+         const bool quote = value.empty() || ( value == csv.null ) || ( value == "\\." ) || ( value.find_first_of( special, 0, sizeof( special ) ) != std::string_view::npos );
+         if( !quote ) {
+            buffer += value;
+            return;
+         }
+         buffer += csv.quote;
+         for( const char c : value ) {
+            if( c == csv.quote ) {
+               buffer += csv.quote;
+            }
+            buffer += c;
+         }
+         buffer += csv.quote;
+      }
+
+      void csv_append_text( std::string& buffer, std::string& field, const csv_options& csv )
+      {
+         if( field == "\\N" ) {
+            buffer += csv.null;
+            return;
+         }
+         std::size_t out = 0;
+         for( std::size_t i = 0; i != field.size(); ++i ) {
+            char c = field[ i ];
+            if( c == '\\' ) {
+               if( ++i == field.size() ) {
+                  throw std::invalid_argument( "invalid COPY text field: trailing backslash" );
+               }
+               switch( field[ i ] ) {
+                  case 'b':
+                     c = '\b';
+                     break;
+
+                  case 'f':
+                     c = '\f';
+                     break;
+
+                  case 'n':
+                     c = '\n';
+                     break;
+
+                  case 'r':
+                     c = '\r';
+                     break;
+
+                  case 't':
+                     c = '\t';
+                     break;
+
+                  case 'v':
+                     c = '\v';
+                     break;
+
+                  default:
+                     c = field[ i ];
+               }
+            }
+            field[ out++ ] = c;
+         }
+         field.resize( out );
+         internal::csv_append( buffer, field, csv );
+      }
+
+      namespace
+      {
+         // large slices with page-aligned offsets, the last one might be shorter
+         constexpr std::size_t copy_file_slice = 1024 * 1024;
+
+         [[noreturn]] void throw_invalid_row( const std::size_t row, const std::size_t expected, const std::size_t actual )
+         {
+            throw std::runtime_error( std::format( "invalid COPY data in row {}: expected {} columns, found {}", row, expected, actual ) );
+         }
+
+         void validate_text( std::string_view data, const std::size_t columns )
+         {
+            std::size_t row = 0;
+            while( !data.empty() ) {
+               ++row;
+               const auto n = data.find( '\n' );
+               if( n == std::string_view::npos ) {
+                  throw std::runtime_error( std::format( "invalid COPY data in row {}: missing newline", row ) );
+               }
+               const auto line = data.substr( 0, n );
+               const auto fields = static_cast< std::size_t >( std::count( line.begin(), line.end(), '\t' ) ) + 1;
+               if( fields != columns ) {
+                  throw_invalid_row( row, columns, fields );
+               }
+               data.remove_prefix( n + 1 );
+            }
+         }
+
+         void validate_csv( std::string_view data, const std::size_t columns, const csv_options& csv )
+         {
+            std::size_t row = 1;
+            std::size_t fields = 1;
+            bool quoted = false;
+            for( const char c : data ) {
+               if( c == csv.quote ) {
+                  quoted = !quoted;  // a doubled quote toggles twice
+               }
+               else if( !quoted ) {
+                  if( c == csv.delimiter ) {
+                     ++fields;
+                  }
+                  else if( c == '\n' ) {
+                     if( fields != columns ) {
+                        throw_invalid_row( row, columns, fields );
+                     }
+                     ++row;
+                     fields = 1;
+                  }
+               }
+            }
+            if( quoted || ( !data.empty() && ( data.back() != '\n' ) ) ) {
+               throw std::runtime_error( std::format( "invalid COPY data in row {}: incomplete row", row ) );
+            }
+         }
+
+         void validate_binary( std::string_view data, const std::size_t columns )
+         {
+            std::size_t row = 0;
+            while( !data.empty() ) {
+               ++row;
+               if( data.size() < 2 ) {
+                  throw std::runtime_error( std::format( "invalid COPY data in row {}: incomplete row", row ) );
+               }
+               const auto fields = internal::from_big_endian< std::int16_t >( data.data() );
+               data.remove_prefix( 2 );
+               if( static_cast< std::size_t >( fields ) != columns ) {
+                  throw_invalid_row( row, columns, static_cast< std::size_t >( fields ) );
+               }
+               for( std::int16_t i = 0; i != fields; ++i ) {
+                  if( data.size() < 4 ) {
+                     throw std::runtime_error( std::format( "invalid COPY data in row {}: incomplete row", row ) );
+                  }
+                  const auto length = internal::from_big_endian< std::int32_t >( data.data() );
+                  data.remove_prefix( 4 );
+                  if( length < -1 ) {
+                     throw std::runtime_error( std::format( "invalid COPY data in row {}: invalid field length {}", row, length ) );
+                  }
+                  if( length > 0 ) {
+                     if( data.size() < static_cast< std::size_t >( length ) ) {
+                        throw std::runtime_error( std::format( "invalid COPY data in row {}: incomplete row", row ) );
+                     }
+                     data.remove_prefix( static_cast< std::size_t >( length ) );
+                  }
+               }
+            }
+         }
+
+         // the rows between the header and the trailer of a binary COPY file
+         [[nodiscard]] auto binary_rows( std::string_view data ) -> std::string_view
+         {
+            if( ( data.size() < 21 ) || ( data.substr( 0, 11 ) != std::string_view( "PGCOPY\n\377\r\n\0", 11 ) ) ) {
+               throw std::runtime_error( "invalid binary COPY header" );
+            }
+            // bit 16 means WITH OIDS, the upper half holds critical flags we do not understand
+            const auto flags = internal::from_big_endian< std::uint32_t >( data.data() + 11 );
+            if( ( flags & 0xffff0000 ) != 0 ) {
+               throw std::runtime_error( "invalid binary COPY header" );
+            }
+            const auto extension = internal::from_big_endian< std::uint32_t >( data.data() + 15 );
+            if( data.size() - 21 < extension ) {
+               throw std::runtime_error( "invalid binary COPY header" );
+            }
+            data.remove_prefix( 19 + extension );
+            if( internal::from_big_endian< std::int16_t >( data.data() + data.size() - 2 ) != -1 ) {
+               throw std::runtime_error( "invalid binary COPY trailer" );
+            }
+            data.remove_suffix( 2 );
+            return data;
+         }
+
+      }  // namespace
+
+   }  // namespace internal
+
    table_writer::~table_writer()
    {
       if( m_transaction ) {
@@ -36,6 +230,12 @@ namespace tao::pq
       const auto result = m_transaction->connection()->get_result( end );
       switch( PQresultStatus( result.get() ) ) {
          case PGRES_COPY_IN:
+            m_columns = PQnfields( result.get() );
+            m_binary = ( PQbinaryTuples( result.get() ) != 0 );
+            if( m_binary ) {
+               // signature, flags, and header extension length, see PostgreSQL's COPY documentation
+               m_buffer.append( "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19 );
+            }
             break;
 
          case PGRES_COPY_OUT:
@@ -60,13 +260,75 @@ namespace tao::pq
       }
    }
 
+   void table_writer::set_csv( csv_options options )
+   {
+      if( m_binary ) {
+         throw std::logic_error( "CSV options for binary COPY" );
+      }
+      m_csv = std::move( options );
+   }
+
    void table_writer::insert_raw( const std::string_view data )
    {
-      m_transaction->connection()->put_copy_data( data.data(), data.size() );
+      if( m_buffer.empty() && ( data.size() >= m_flush_threshold ) ) {
+         m_transaction->connection()->put_copy_data( data.data(), data.size() );
+      }
+      else {
+         m_buffer += data;
+         table_writer::flush_if_needed();
+      }
+   }
+
+   auto table_writer::insert_file( const std::filesystem::path& path, const bool validate, const std::function< void( std::size_t sent, std::size_t total ) >& progress ) -> std::size_t
+   {
+      const internal::mapped_file file( path );
+      auto data = file.view();
+      if( m_binary ) {
+         // our own header was already added to the buffer
+         data = internal::binary_rows( data );
+      }
+
+      if( validate ) {
+         if( m_binary ) {
+            internal::validate_binary( data, m_columns );
+         }
+         else if( m_csv ) {
+            internal::validate_csv( data, m_columns, *m_csv );
+         }
+         else {
+            internal::validate_text( data, m_columns );
+         }
+      }
+
+      table_writer::flush();
+      std::size_t sent = 0;
+      // the first slice ends at a slice boundary of the mapping, so all following slices start page-aligned
+      const auto offset = static_cast< std::size_t >( data.data() - file.data() ) % internal::copy_file_slice;
+      while( sent != data.size() ) {
+         const auto size = std::min( internal::copy_file_slice - ( ( sent == 0 ) ? offset : 0 ), data.size() - sent );
+         m_transaction->connection()->put_copy_data( data.data() + sent, size );
+         sent += size;
+         if( progress ) {
+            progress( sent, data.size() );
+         }
+      }
+      return sent;
+   }
+
+   void table_writer::flush()
+   {
+      if( !m_buffer.empty() ) {
+         m_transaction->connection()->put_copy_data( m_buffer.data(), m_buffer.size() );
+         m_buffer.clear();
+      }
    }
 
    auto table_writer::commit() -> std::size_t
    {
+      if( m_binary ) {
+         internal::append_big_endian( m_buffer, std::int16_t( -1 ) );
+      }
+      table_writer::flush();
       m_transaction->connection()->put_copy_end();
       const auto rows_affected = m_transaction->get_result().rows_affected();
       m_transaction.reset();
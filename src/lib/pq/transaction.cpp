@@ -13,7 +13,9 @@
 #include <libpq-fe.h>
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/internal/trace.hpp>
 #include <tao/pq/pipeline.hpp>
+#include <tao/pq/trace.hpp>
 
 namespace tao::pq
 {
@@ -148,9 +150,7 @@ namespace tao::pq
       }
       // LCOV_EXCL_START
       catch( ... ) {
-         if( m_connection->m_log && m_connection->m_log->transaction.destructor_rollback_failed ) {
-            m_connection->m_log->transaction.destructor_rollback_failed( *this );
-         }
+         internal::trace< trace_point::transaction_destructor_rollback_failed >( m_connection->m_log, *this );
       }
       // LCOV_EXCL_STOP
       v_reset();
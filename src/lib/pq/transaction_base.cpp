@@ -15,6 +15,7 @@
 
 #include <tao/pq/connection.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/try_result.hpp>
 
 namespace tao::pq
 {
@@ -63,7 +64,7 @@ namespace tao::pq
    }
 #endif
 
-   auto transaction_base::get_result( const std::chrono::steady_clock::time_point start ) -> result
+   auto transaction_base::get_raw_result( const std::chrono::steady_clock::time_point start ) -> std::unique_ptr< PGresult, decltype( &PQclear ) >
    {
       check_current_transaction();
       const auto end = m_connection->timeout_end( start );
@@ -90,12 +91,37 @@ namespace tao::pq
 #if defined( LIBPQ_HAS_CHUNK_MODE )
          case PGRES_TUPLES_CHUNK:
 #endif
-            return pq::result( result.release() );
+            return result;
 
          default:;
       }
 
       m_connection->consume_empty_result( end );
+      return result;
+   }
+
+   auto transaction_base::get_result( const std::chrono::steady_clock::time_point start ) -> result
+   {
+      return pq::result( get_raw_result( start ).release() );
+   }
+
+   auto transaction_base::try_get_result( const std::chrono::steady_clock::time_point start ) -> try_result
+   {
+      auto result = get_raw_result( start );
+      switch( PQresultStatus( result.get() ) ) {
+         case PGRES_BAD_RESPONSE:
+         case PGRES_NONFATAL_ERROR:
+         case PGRES_FATAL_ERROR:
+            if( const char* sql_state = PQresultErrorField( result.get(), PG_DIAG_SQLSTATE ) ) {
+               const char* message = PQresultErrorField( result.get(), PG_DIAG_MESSAGE_PRIMARY );
+               const char* detail = PQresultErrorField( result.get(), PG_DIAG_MESSAGE_DETAIL );
+               const char* what = PQresultErrorMessage( result.get() );
+               return sql_error_info{ sql_state, ( message != nullptr ) ? message : what, ( detail != nullptr ) ? detail : "", what };
+            }
+            break;
+
+         default:;
+      }
       return pq::result( result.release() );
    }
 
@@ -0,0 +1,257 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/benchmark.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <format>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq.hpp>
+#include <tao/pq/internal/copy_scan.hpp>
+#include <tao/pq/internal/pool.hpp>
+
+// micro-benchmarks of the hot paths that do not need a database,
+// run with an optional name filter, e.g. "benchmark_micro decode"
+
+namespace
+{
+   using tao::pq::internal::benchmark::do_not_optimize;
+   using tao::pq::internal::benchmark::runner;
+
+   template< typename T >
+   void encode( const T& v )
+   {
+      const tao::pq::parameter_traits< T > traits( v );
+      do_not_optimize( traits.template value< 0 >() );
+      do_not_optimize( traits.template length< 0 >() );
+   }
+
+   void run_encode( runner& r )
+   {
+      const int i = 123456789;
+      const double d = 3.14159265358979;
+      const std::string s( 100, 'x' );
+      const std::vector< int > a( 100, 42 );
+      const std::tuple< int, double, std::string > t( i, d, s );
+
+      r.run( "encode/int", [ & ] { encode( i ); } );
+      r.run( "encode/double", [ & ] { encode( d ); } );
+      r.run( "encode/string_100", [ & ] { encode( s ); } );
+      r.run( "encode/array_int_100", [ & ] { encode( a ); } );
+      r.run( "encode/tuple", [ & ] {
+         const tao::pq::parameter_traits< std::tuple< int, double, std::string > > traits( t );
+         do_not_optimize( traits.template value< 0 >() );
+         do_not_optimize( traits.template value< 1 >() );
+         do_not_optimize( traits.template value< 2 >() );
+      } );
+   }
+
+   // a result as returned by the server, built without a connection
+   class synthetic_result final
+   {
+   private:
+      std::unique_ptr< PGresult, decltype( &PQclear ) > m_result;
+
+   public:
+      synthetic_result( const int rows, const std::vector< std::string >& values )
+         : m_result( PQmakeEmptyPGresult( nullptr, PGRES_TUPLES_OK ), &PQclear )
+      {
+         if( !m_result ) {
+            throw std::runtime_error( "PQmakeEmptyPGresult() failed" );  // LCOV_EXCL_LINE
+         }
+         std::vector< std::string > names;
+         std::vector< PGresAttDesc > attributes( values.size() );
+         for( std::size_t i = 0; i != values.size(); ++i ) {
+            names.push_back( std::format( "c{}", i ) );
+            attributes[ i ].name = names.back().data();
+            attributes[ i ].format = 0;
+            attributes[ i ].typlen = -1;
+            attributes[ i ].atttypmod = -1;
+         }
+         if( PQsetResultAttrs( m_result.get(), static_cast< int >( attributes.size() ), attributes.data() ) == 0 ) {
+            throw std::runtime_error( "PQsetResultAttrs() failed" );  // LCOV_EXCL_LINE
+         }
+         for( int row = 0; row != rows; ++row ) {
+            for( std::size_t column = 0; column != values.size(); ++column ) {
+               auto& value = values[ column ];
+               if( PQsetvalue( m_result.get(), row, static_cast< int >( column ), const_cast< char* >( value.data() ), static_cast< int >( value.size() ) ) == 0 ) {  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                  throw std::runtime_error( "PQsetvalue() failed" );  // LCOV_EXCL_LINE
+               }
+            }
+         }
+      }
+
+      [[nodiscard]] auto get() const noexcept -> const PGresult*
+      {
+         return m_result.get();
+      }
+   };
+
+   template< typename T >
+   [[nodiscard]] auto decode( const PGresult* result, const int row, const int column ) -> T
+   {
+      return tao::pq::result_traits< T >::from( PQgetvalue( result, row, column ) );
+   }
+
+   void run_decode( runner& r )
+   {
+      constexpr int rows = 1000;
+      const synthetic_result result( rows, { "123456789", "3.14159265358979", std::string( 32, 'x' ), "\\x" + std::string( 64, 'a' ), "{1,2,3,4,5,6,7,8,9,10}" } );
+      const auto* const res = result.get();
+
+      r.run( "decode/int_1000_rows", [ & ] {
+         for( int row = 0; row != rows; ++row ) {
+            do_not_optimize( decode< int >( res, row, 0 ) );
+         }
+      } );
+      r.run( "decode/double_1000_rows", [ & ] {
+         for( int row = 0; row != rows; ++row ) {
+            do_not_optimize( decode< double >( res, row, 1 ) );
+         }
+      } );
+      r.run( "decode/string_1000_rows", [ & ] {
+         for( int row = 0; row != rows; ++row ) {
+            do_not_optimize( decode< std::string >( res, row, 2 ) );
+         }
+      } );
+      r.run( "decode/bytea_1000_rows", [ & ] {
+         for( int row = 0; row != rows; ++row ) {
+            do_not_optimize( decode< tao::pq::binary >( res, row, 3 ) );
+         }
+      } );
+      r.run( "decode/array_1000_rows", [ & ] {
+         for( int row = 0; row != rows; ++row ) {
+            do_not_optimize( decode< std::vector< int > >( res, row, 4 ) );
+         }
+      } );
+      r.run( "decode/row_1000_rows", [ & ] {
+         for( int row = 0; row != rows; ++row ) {
+            do_not_optimize( decode< int >( res, row, 0 ) );
+            do_not_optimize( decode< double >( res, row, 1 ) );
+            do_not_optimize( decode< std::string >( res, row, 2 ) );
+            do_not_optimize( decode< tao::pq::binary >( res, row, 3 ) );
+            do_not_optimize( decode< std::vector< int > >( res, row, 4 ) );
+         }
+      } );
+   }
+
+   void run_parse( runner& r )
+   {
+      // table_reader::parse_data() needs a live transaction, scanning the row is its hot path
+      const std::string plain = "42\tsome text value\t3.14159\t2026-01-01 12:00:00\tf\n";
+      const std::string escaped = "42\tsome\\ttext\\nvalue\t3.14159\t\\N\tf\n";
+      std::vector< std::size_t > positions;
+      positions.reserve( 16 );
+
+      r.run( "parse/copy_row", [ & ] {
+         positions.clear();
+         do_not_optimize( tao::pq::internal::scan_copy_row( plain.data(), plain.size(), positions ) );
+      } );
+      r.run( "parse/copy_row_escaped", [ & ] {
+         positions.clear();
+         do_not_optimize( tao::pq::internal::scan_copy_row( escaped.data(), escaped.size(), positions ) );
+      } );
+
+      std::string ints = "{";
+      std::string texts = "{";
+      for( int i = 0; i != 100; ++i ) {
+         ints += std::format( "{}{}", ( i == 0 ) ? "" : ",", i * 1000 );
+         texts += std::format( "{}\"value {}\"", ( i == 0 ) ? "" : ",", i );
+      }
+      ints += '}';
+      texts += '}';
+
+      r.run( "parse/array_int_100", [ & ] { do_not_optimize( tao::pq::result_traits< std::vector< int > >::from( ints.c_str() ) ); } );
+      r.run( "parse/array_text_100", [ & ] { do_not_optimize( tao::pq::result_traits< std::vector< std::string > >::from( texts.c_str() ) ); } );
+      r.run( "parse/array_2d_10x10", [ & ] {
+         do_not_optimize( tao::pq::result_traits< std::vector< std::vector< int > > >::from( "{{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},"
+                                                                                             "{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10},{1,2,3,4,5,6,7,8,9,10}}" ) );
+      } );
+
+      const std::string hex_1k = "\\x" + std::string( 2048, 'f' );
+      const std::string hex_64k = "\\x" + std::string( 128 * 1024, '5' );
+      r.run( "parse/bytea_unhex_1k", [ & ] { do_not_optimize( tao::pq::result_traits< tao::pq::binary >::from( hex_1k.c_str() ) ); } );
+      r.run( "parse/bytea_unhex_64k", [ & ] { do_not_optimize( tao::pq::result_traits< tao::pq::binary >::from( hex_64k.c_str() ) ); } );
+   }
+
+   void run_error( runner& r )
+   {
+      for( const char* sql_state : { "23505", "40001", "XX002", "42999" } ) {
+         r.run( std::format( "error/throw_sqlstate_{}", sql_state ), [ & ] {
+            try {
+               tao::pq::internal::throw_sqlstate( "message", sql_state );
+            }
+            catch( const tao::pq::sql_error& e ) {
+               do_not_optimize( e.sqlstate.size() );
+            }
+         } );
+      }
+   }
+
+   class test_pool final
+      : public tao::pq::internal::pool< int >
+   {
+   protected:
+      [[nodiscard]] auto v_create() const -> std::unique_ptr< int > override
+      {
+         return std::make_unique< int >( 0 );
+      }
+
+      [[nodiscard]] auto v_is_valid( int& /*unused*/ ) const noexcept -> bool override
+      {
+         return true;
+      }
+   };
+
+   void run_pool( runner& r )
+   {
+      const auto pool = std::make_shared< test_pool >();
+      for( const std::size_t threads : { 1, 2, 4, 8 } ) {
+         r.run(
+            std::format( "pool/get_release_{}_threads", threads ),
+            [ & ] {
+               const auto sp = pool->get();
+               ++*sp;
+            },
+            threads );
+      }
+   }
+
+   void run( const int argc, char** argv )
+   {
+      runner r( argc, argv );
+      run_encode( r );
+      run_decode( r );
+      run_parse( r );
+      run_error( r );
+      run_pool( r );
+   }
+
+}  // namespace
+
+auto main( int argc, char** argv ) -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run( argc, argv );
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
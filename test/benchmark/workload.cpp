@@ -0,0 +1,267 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/benchmark.hpp"
+#include "utils/getenv.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <format>
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tao/pq.hpp>
+
+// compares execution strategies for the same workloads against a live database,
+// run with an optional name filter, e.g. "benchmark_workload point_select/"
+
+namespace
+{
+   using tao::pq::internal::benchmark::do_not_optimize;
+   using tao::pq::internal::benchmark::runner;
+
+   using connection_t = std::shared_ptr< tao::pq::connection >;
+
+   constexpr int table_size = 100000;
+   constexpr std::size_t batch_size = 16;
+   constexpr std::size_t bulk_size = 10000;
+   constexpr std::size_t pipeline_depth = 100;
+
+   constexpr std::initializer_list< std::size_t > concurrency = { 1, 2, 4, 8 };
+
+   [[nodiscard]] auto random_id() -> int
+   {
+      thread_local std::minstd_rand engine( std::random_device{}() );
+      return std::uniform_int_distribution< int >( 1, table_size )( engine );
+   }
+
+   void prepare( tao::pq::connection& c )
+   {
+      c.prepare( "select_item", "SELECT name, value FROM tao_benchmark_items WHERE id = $1" );
+      c.prepare( "insert_item", "INSERT INTO tao_benchmark_inserts ( id, name, value ) VALUES ( $1, $2, $3 )" );
+   }
+
+   void setup( tao::pq::connection_pool& pool )
+   {
+      const auto c = pool.connection();
+      c->execute( "DROP TABLE IF EXISTS tao_benchmark_items" );
+      c->execute( "CREATE TABLE tao_benchmark_items ( id INTEGER PRIMARY KEY, name TEXT NOT NULL, value DOUBLE PRECISION NOT NULL )" );
+      c->execute( "DROP TABLE IF EXISTS tao_benchmark_inserts" );
+      c->execute( "CREATE TABLE tao_benchmark_inserts ( id INTEGER NOT NULL, name TEXT NOT NULL, value DOUBLE PRECISION NOT NULL )" );
+
+      tao::pq::table_writer tw( c->direct(), "COPY tao_benchmark_items ( id, name, value ) FROM STDIN" );
+      for( int i = 1; i <= table_size; ++i ) {
+         tw.insert( i, std::format( "item {}", i ), i * 0.5 );
+      }
+      (void)tw.commit();
+      c->execute( "ANALYZE tao_benchmark_items" );
+
+      // the pool keeps these connections, so no more are created while the benchmarks run
+      std::vector< connection_t > connections;
+      for( std::size_t i = 0; i != *std::max_element( concurrency.begin(), concurrency.end() ); ++i ) {
+         connections.push_back( pool.connection() );
+         prepare( *connections.back() );
+      }
+   }
+
+   void truncate( tao::pq::connection_pool& pool )
+   {
+      pool.execute( "TRUNCATE tao_benchmark_inserts" );
+   }
+
+   // each operation gets a connection from the pool, so the pool's overhead is included
+   template< typename F >
+   void run_concurrent( runner& r, tao::pq::connection_pool& pool, const std::string_view name, const std::size_t items, const std::initializer_list< std::size_t > threads, const F& f )
+   {
+      for( const auto t : threads ) {
+         r.run_workload( std::format( "{}/{}_threads", name, t ), t, items, [ & ]( const std::size_t /*unused*/ ) {
+            f( pool.connection() );
+         } );
+      }
+   }
+
+   void decode( const tao::pq::result& result )
+   {
+      for( const auto& row : result ) {
+         do_not_optimize( row.tuple< std::string, double >() );
+      }
+   }
+
+   void run_point_select( runner& r, tao::pq::connection_pool& pool )
+   {
+      run_concurrent( r, pool, "point_select/execute", 1, concurrency, []( const connection_t& c ) {
+         decode( c->execute( "SELECT name, value FROM tao_benchmark_items WHERE id = $1", random_id() ) );
+      } );
+      run_concurrent( r, pool, "point_select/prepared", 1, concurrency, []( const connection_t& c ) {
+         decode( c->execute( "select_item", random_id() ) );
+      } );
+      run_concurrent( r, pool, "point_select/pipeline", batch_size, concurrency, []( const connection_t& c ) {
+         const auto pl = c->pipeline();
+         for( std::size_t i = 0; i != batch_size; ++i ) {
+            pl->send( "select_item", random_id() );
+         }
+         pl->sync();
+         for( std::size_t i = 0; i != batch_size; ++i ) {
+            decode( pl->get_result() );
+         }
+         pl->consume_sync();
+         pl->finish();
+      } );
+   }
+
+   void insert( tao::pq::transaction_base& tr, const int id )
+   {
+      tr.send( "insert_item", id, "inserted", id * 0.5 );
+   }
+
+   // keeps one batch in flight while the results of the previous batch are received
+   void pipeline_insert( const connection_t& c, const std::size_t rows )
+   {
+      const auto tr = c->transaction();
+      const auto pl = tr->pipeline();
+      std::size_t pending = 0;
+      for( std::size_t i = 0; i < rows; i += pipeline_depth ) {
+         const auto n = std::min( pipeline_depth, rows - i );
+         for( std::size_t j = 0; j != n; ++j ) {
+            insert( *pl, random_id() );
+         }
+         pl->sync();
+         for( std::size_t j = 0; j != pending; ++j ) {
+            (void)pl->get_result();
+         }
+         if( pending != 0 ) {
+            pl->consume_sync();
+         }
+         pending = n;
+      }
+      for( std::size_t j = 0; j != pending; ++j ) {
+         (void)pl->get_result();
+      }
+      pl->consume_sync();
+      pl->finish();
+      tr->commit();
+   }
+
+   void copy_insert( const connection_t& c, const std::size_t rows )
+   {
+      tao::pq::table_writer tw( c->direct(), "COPY tao_benchmark_inserts ( id, name, value ) FROM STDIN" );
+      for( std::size_t i = 0; i != rows; ++i ) {
+         const auto id = random_id();
+         tw.insert( id, "inserted", id * 0.5 );
+      }
+      (void)tw.commit();
+   }
+
+   void run_small_insert( runner& r, tao::pq::connection_pool& pool )
+   {
+      truncate( pool );
+      run_concurrent( r, pool, "small_insert/execute", 1, concurrency, []( const connection_t& c ) {
+         const auto id = random_id();
+         c->execute( "INSERT INTO tao_benchmark_inserts ( id, name, value ) VALUES ( $1, $2, $3 )", id, "inserted", id * 0.5 );
+      } );
+      run_concurrent( r, pool, "small_insert/prepared", 1, concurrency, []( const connection_t& c ) {
+         const auto id = random_id();
+         c->execute( "insert_item", id, "inserted", id * 0.5 );
+      } );
+      run_concurrent( r, pool, "small_insert/pipeline", batch_size, concurrency, []( const connection_t& c ) {
+         pipeline_insert( c, batch_size );
+      } );
+      run_concurrent( r, pool, "small_insert/table_writer", batch_size, concurrency, []( const connection_t& c ) {
+         copy_insert( c, batch_size );
+      } );
+   }
+
+   void run_bulk_load( runner& r, tao::pq::connection_pool& pool )
+   {
+      truncate( pool );
+      run_concurrent( r, pool, "bulk_load/prepared", bulk_size, { 1, 4 }, []( const connection_t& c ) {
+         const auto tr = c->transaction();
+         for( std::size_t i = 0; i != bulk_size; ++i ) {
+            const auto id = random_id();
+            tr->execute( "insert_item", id, "inserted", id * 0.5 );
+         }
+         tr->commit();
+      } );
+      run_concurrent( r, pool, "bulk_load/pipeline", bulk_size, { 1, 4 }, []( const connection_t& c ) {
+         pipeline_insert( c, bulk_size );
+      } );
+      run_concurrent( r, pool, "bulk_load/table_writer", bulk_size, { 1, 4 }, []( const connection_t& c ) {
+         copy_insert( c, bulk_size );
+      } );
+      truncate( pool );
+   }
+
+   void run_large_scan( runner& r, tao::pq::connection_pool& pool )
+   {
+      static constexpr const char* statement = "SELECT name, value FROM tao_benchmark_items";
+
+      run_concurrent( r, pool, "large_scan/execute", table_size, { 1, 4 }, []( const connection_t& c ) {
+         decode( c->execute( statement ) );
+      } );
+      run_concurrent( r, pool, "large_scan/single_row", table_size, { 1, 4 }, []( const connection_t& c ) {
+         const auto tr = c->direct();
+         tr->send( statement );
+         tr->set_single_row_mode();
+         while( true ) {
+            const auto result = tr->get_result();
+            if( result.empty() ) {
+               break;
+            }
+            decode( result );
+         }
+      } );
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+      run_concurrent( r, pool, "large_scan/chunk_1000", table_size, { 1, 4 }, []( const connection_t& c ) {
+         const auto tr = c->direct();
+         tr->send( statement );
+         tr->set_chunk_mode( 1000 );
+         while( true ) {
+            const auto result = tr->get_result();
+            if( result.empty() ) {
+               break;
+            }
+            decode( result );
+         }
+      } );
+#endif
+   }
+
+   void run( const int argc, char** argv )
+   {
+      // overwrite the default with an environment variable if needed
+      const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+      const auto pool = tao::pq::connection_pool::create( connection_string );
+
+      runner r( argc, argv );
+      setup( *pool );
+      run_point_select( r, *pool );
+      run_small_insert( r, *pool );
+      run_bulk_load( r, *pool );
+      run_large_scan( r, *pool );
+   }
+
+}  // namespace
+
+auto main( int argc, char** argv ) -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run( argc, argv );
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -145,6 +145,53 @@ namespace
 
          const auto result = connection->execute( "SELECT * FROM tao_array_test WHERE a = ANY( $1 )", std::array{ 2, 3, 5, 6, 9 } );
          TEST_ASSERT( result.vector< int >() == std::vector< int >{ 2, 3, 5, 6 } );
+
+         std::vector< long long > ids;
+         for( long long i = 0; i < 100000; i += 2 ) {
+            ids.push_back( i );
+         }
+         TEST_ASSERT( connection->execute( "SELECT * FROM tao_array_test WHERE a = ANY( $1 )", ids ).vector< int >() == std::vector< int >{ 2, 4, 6, 8 } );
+         TEST_ASSERT( connection->execute( "SELECT array_length( $1, 1 )", ids ).as< std::size_t >() == ids.size() );
+      }
+
+      {
+         connection->set_result_format( tao::pq::result_format::binary_format );
+
+         const auto r1 = connection->execute( "SELECT '{1,2,3,1701}'::INT4[]" ).as< std::vector< int > >();
+         TEST_ASSERT( r1 == std::vector< int >{ 1, 2, 3, 1701 } );
+
+         const auto r2 = connection->execute( "SELECT '{1,NULL,3}'::INT8[]" ).as< std::vector< std::optional< long long > > >();
+         TEST_ASSERT( r2.size() == 3 );
+         TEST_ASSERT( r2[ 0 ] == 1 );
+         TEST_ASSERT( !r2[ 1 ] );
+         TEST_ASSERT( r2[ 2 ] == 3 );
+
+         const auto r3 = connection->execute( "SELECT '{{1.5,2.5},{3.5,4.5}}'::FLOAT8[][]" ).as< std::vector< std::vector< double > > >();
+         TEST_ASSERT( r3 == std::vector< std::vector< double > >{ { 1.5, 2.5 }, { 3.5, 4.5 } } );
+
+         const auto r4 = connection->execute( "SELECT '{FOO,\"B,A\\\"R\"}'::TEXT[]" ).as< std::vector< std::string > >();
+         TEST_ASSERT( r4 == std::vector< std::string >{ "FOO", "B,A\"R" } );
+
+         TEST_ASSERT( connection->execute( "SELECT '{}'::INT4[]" ).as< std::vector< int > >().empty() );
+         TEST_THROWS( connection->execute( "SELECT '{1,NULL}'::INT4[]" ).as< std::vector< int > >() );
+         TEST_THROWS( connection->execute( "SELECT '{{1},{2}}'::INT4[]" ).as< std::vector< int > >() );
+         TEST_THROWS( connection->execute( "SELECT '{1.5,2.5}'::FLOAT4[]" ).as< std::vector< int > >() );
+
+         // the column type must match, the size alone is ambiguous
+         TEST_ASSERT( connection->execute( "SELECT 1.5::REAL" ).as< double >() == 1.5 );
+         TEST_THROWS( connection->execute( "SELECT 1.5::REAL" ).as< int >() );
+         TEST_THROWS( connection->execute( "SELECT 42::INT8" ).as< double >() );
+         TEST_THROWS( connection->execute( "SELECT 'abcd'::TEXT" ).as< int >() );
+         TEST_THROWS( connection->execute( "SELECT 42" ).as< std::string >() );
+         TEST_ASSERT( connection->execute( "SELECT 'abcd'::VARCHAR" ).as< std::string >() == "abcd" );
+
+         const auto m = connection->execute( "SELECT '{{1.5,2.5,3.5},{4.5,5.5,6.5}}'::FLOAT8[][]" ).as< tao::pq::md_array< double > >();
+         TEST_ASSERT( m == tao::pq::md_array< double >( { 1.5, 2.5, 3.5, 4.5, 5.5, 6.5 }, { 2, 3 } ) );
+
+         connection->reset_result_format();
+
+         const auto t = connection->execute( "SELECT '{{1.5,2.5,3.5},{4.5,5.5,6.5}}'::FLOAT8[][]" ).as< tao::pq::md_array< double > >();
+         TEST_ASSERT( t == m );
       }
    }
 
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/getenv.hpp"
+#include "utils/macros.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <tao/pq.hpp>
+
+namespace
+{
+   [[nodiscard]] auto count( const std::string& s, const std::string_view what ) -> std::size_t
+   {
+      std::size_t result = 0;
+      for( auto pos = s.find( what ); pos != std::string::npos; pos = s.find( what, pos + what.size() ) ) {
+         ++result;
+      }
+      return result;
+   }
+
+   void run()
+   {
+      const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+      const auto path = std::filesystem::temp_directory_path() / "taopq_chrome_trace.json";
+
+      {
+         const tao::pq::chrome_trace trace( path );
+         const auto pool = tao::pq::connection_pool::create( connection_string );
+         trace.attach( *pool );
+
+         const auto connection = pool->connection();
+         connection->execute( "DROP TABLE IF EXISTS tao_chrome_trace" );
+         connection->execute( "CREATE TABLE tao_chrome_trace ( a INTEGER )" );
+         {
+            const auto tr = connection->transaction();
+            tr->execute( "INSERT INTO tao_chrome_trace VALUES ( $1 )", 1 );
+            tao::pq::table_writer tw( tr, "COPY tao_chrome_trace ( a ) FROM STDIN" );
+            tw.insert( 2 );
+            TEST_ASSERT( tw.commit() == 1 );
+            tr->commit();
+         }
+         {
+            const auto pipeline = connection->pipeline();
+            pipeline->send( "SELECT \"a\"\n FROM tao_chrome_trace" );
+            pipeline->sync();
+            TEST_ASSERT( pipeline->get_result().size() == 2 );
+            pipeline->consume_sync();
+            pipeline->finish();
+         }
+         connection->execute( "DROP TABLE tao_chrome_trace" );
+         TEST_ASSERT( trace.dropped() == 0 );
+      }
+
+      std::ostringstream stream;
+      stream << std::ifstream( path ).rdbuf();
+      const std::string json = stream.str();
+      std::filesystem::remove( path );
+
+      TEST_ASSERT( json.starts_with( "{\"traceEvents\":[" ) );
+      TEST_ASSERT( json.ends_with( "],\"displayTimeUnit\":\"ms\"}\n" ) );
+      TEST_ASSERT( count( json, "\"cat\":\"pool\"" ) == 1 );
+      TEST_ASSERT( count( json, "\"cat\":\"query\"" ) == 8 );
+      TEST_ASSERT( count( json, "\"cat\":\"transaction\"" ) == 1 );
+      TEST_ASSERT( count( json, "\"cat\":\"copy\"" ) == 1 );
+      TEST_ASSERT( count( json, "\"cat\":\"pipeline\"" ) == 1 );
+      TEST_ASSERT( count( json, "\"statement\":\"SELECT \\\"a\\\"\\n FROM tao_chrome_trace\"" ) == 1 );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
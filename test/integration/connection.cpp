@@ -151,6 +151,60 @@ namespace
          TEST_ASSERT( *connection->poll_callback().target< callback_t >() == old_cb );
       }
 
+      {
+         connection->reset_stats();
+         const auto empty = connection->stats();
+         TEST_ASSERT( empty.statements_sent == 0 );
+         TEST_ASSERT( empty.wait_time == std::chrono::nanoseconds( 0 ) );
+
+         TEST_ASSERT( connection->execute( "SELECT $1::TEXT FROM generate_series( 1, 3 )", "abc" ).size() == 3 );
+         const auto stats = connection->stats();
+         TEST_ASSERT( stats.statements_sent == 1 );
+         TEST_ASSERT( stats.results_received == 1 );
+         TEST_ASSERT( stats.rows_received == 3 );
+         TEST_ASSERT( stats.round_trips == 1 );
+         TEST_ASSERT( stats.bytes_sent == 44 );
+         TEST_ASSERT( stats.bytes_received >= 9 );
+         TEST_ASSERT( stats.poll_wakeups >= 1 );
+         TEST_ASSERT( stats.wait_time > std::chrono::nanoseconds( 0 ) );
+
+         // binary parameters are counted, text parameters are not
+         connection->reset_stats();
+         TEST_ASSERT( connection->execute( "SELECT $1::TEXT", std::string( "abc" ) ).as< std::string >() == "abc" );
+         TEST_ASSERT( connection->stats().bytes_sent == 18 );
+
+         const auto tr = connection->transaction();
+         tr->execute( "CREATE TEMPORARY TABLE tao_connection_stats ( a TEXT )" );
+         {
+            tao::pq::table_writer tw( tr, "COPY tao_connection_stats ( a ) FROM STDIN" );
+            tw.insert( "abc" );
+            tw.insert( "def" );
+            TEST_ASSERT( tw.commit() == 2 );
+         }
+         connection->reset_stats();
+         {
+            tao::pq::table_reader tr2( tr, "COPY tao_connection_stats ( a ) TO STDOUT" );
+            TEST_ASSERT( tr2.vector< std::string >().size() == 2 );
+         }
+         TEST_ASSERT( connection->stats().rows_received == 2 );
+         TEST_ASSERT( connection->stats().bytes_received == 8 );
+
+         // the trailer of a binary COPY is not a row, not even after the header of an empty result
+         connection->reset_stats();
+         {
+            tao::pq::table_reader tr2( tr, "COPY tao_connection_stats ( a ) TO STDOUT ( FORMAT binary )" );
+            TEST_ASSERT( tr2.vector< std::string >().size() == 2 );
+         }
+         TEST_ASSERT( connection->stats().rows_received == 2 );
+         connection->reset_stats();
+         {
+            tao::pq::table_reader tr2( tr, "COPY ( SELECT a FROM tao_connection_stats WHERE false ) TO STDOUT ( FORMAT binary )" );
+            TEST_ASSERT( tr2.vector< std::string >().empty() );
+         }
+         TEST_ASSERT( connection->stats().rows_received == 0 );
+         tr->rollback();
+      }
+
       connection->reset_timeout();
       TEST_EXECUTE( connection->execute( "SELECT pg_sleep( 0.2 )" ) );
 
@@ -138,6 +138,97 @@ namespace
          TEST_ASSERT( *pool->connection()->poll_callback().target< callback_t >() == old_cb );
       }
 
+      {
+         const auto log = std::make_shared< tao::pq::log >();
+         std::size_t acquired = 0;
+         std::size_t created = 0;
+         std::size_t released = 0;
+         std::size_t discarded = 0;
+         std::size_t idle = 0;
+         std::size_t attached = 0;
+         bool after_create = false;
+         std::size_t attached_after_create = 0;
+         log->connection_pool.acquire = [ & ]( const tao::pq::connection_pool& p, tao::pq::connection& /*unused*/, const std::chrono::steady_clock::duration d ) {
+            TEST_ASSERT( &p == pool.get() );
+            TEST_ASSERT( d >= std::chrono::steady_clock::duration::zero() );
+            ++acquired;
+         };
+         log->connection_pool.create = [ & ]( const tao::pq::connection_pool& /*unused*/, tao::pq::connection& c, const std::chrono::steady_clock::duration d ) {
+            TEST_ASSERT( c.is_open() );
+            TEST_ASSERT( d > std::chrono::steady_clock::duration::zero() );
+            ++created;
+            after_create = true;
+         };
+         log->connection_pool.release = [ & ]( const tao::pq::connection_pool& /*unused*/, tao::pq::connection& /*unused*/ ) noexcept {
+            ++released;
+         };
+         log->connection_pool.discard = [ & ]( const tao::pq::connection_pool& /*unused*/, tao::pq::connection& /*unused*/ ) noexcept {
+            ++discarded;
+         };
+         log->connection_pool.counts = [ & ]( const tao::pq::connection_pool& /*unused*/, const std::size_t i, const std::size_t a ) noexcept {
+            idle = i;
+            attached = a;
+            if( after_create ) {
+               attached_after_create = a;
+               after_create = false;
+            }
+         };
+         pool->set_log_handler( log );
+
+         TEST_ASSERT( pool->size() == 4 );
+         {
+            const auto conn = pool->connection();
+            TEST_ASSERT( acquired == 1 );
+            TEST_ASSERT( created == 0 );
+            TEST_ASSERT( idle == 3 );
+            TEST_ASSERT( attached == 1 );
+         }
+         TEST_ASSERT( released == 1 );
+         TEST_ASSERT( idle == 4 );
+         TEST_ASSERT( attached == 0 );
+
+         {
+            const auto conn = pool->connection();
+            const auto tr = conn->transaction();
+            tr->execute( "SELECT 1" );
+         }
+         TEST_ASSERT( acquired == 2 );
+         TEST_ASSERT( released == 2 );
+         TEST_ASSERT( discarded == 0 );
+
+         {
+            [[maybe_unused]] const auto c0 = pool->connection();
+            [[maybe_unused]] const auto c1 = pool->connection();
+            [[maybe_unused]] const auto c2 = pool->connection();
+            [[maybe_unused]] const auto c3 = pool->connection();
+            TEST_ASSERT( idle == 0 );
+            TEST_ASSERT( attached == 4 );
+         }
+         TEST_ASSERT( acquired == 6 );
+         TEST_ASSERT( released == 6 );
+         TEST_ASSERT( idle == 4 );
+
+         {
+            auto conn = pool->connection();
+            conn->execute( "BEGIN" );  // leaves the connection in a transaction
+            conn.reset();
+         }
+         TEST_ASSERT( discarded == 1 );
+         TEST_ASSERT( idle == 3 );
+
+         const auto before = created;
+         {
+            [[maybe_unused]] const auto c0 = pool->connection();
+            [[maybe_unused]] const auto c1 = pool->connection();
+            [[maybe_unused]] const auto c2 = pool->connection();
+            [[maybe_unused]] const auto c3 = pool->connection();
+            TEST_ASSERT( created == before + 1 );
+            TEST_ASSERT( attached_after_create == 4 );
+         }
+
+         pool->reset_log_handler();
+      }
+
       using namespace std::chrono_literals;
       pool->set_timeout( 100ms );
       TEST_THROWS( pool->execute( "SELECT pg_sleep( .5 )" ) );
@@ -4,6 +4,8 @@
 
 #include <exception>
 #include <iostream>
+#include <string>
+#include <string_view>
 
 #include "utils/getenv.hpp"
 #include "utils/macros.hpp"
@@ -29,6 +31,50 @@ namespace
       TEST_THROWS( connection->execute( "SELECT 1/0" ) );
       TEST_THROWS( connection->execute( "SELECT * FROM tao_exception_test WHERE a = 42" ) );
       TEST_THROWS( connection->execute( "SELECT * FROM tao_exception_test WHERE a[0] = 'FOO'" ) );
+
+      // errors reported by the server can be returned instead of thrown
+      connection->execute( "INSERT INTO tao_exception_test VALUES ( 'x', 'y' )" );
+      {
+         const auto r = connection->try_execute( "INSERT INTO tao_exception_test VALUES ( $1, $2 )", "x", "z" );
+         TEST_ASSERT( !r );
+         TEST_ASSERT( !r.has_value() );
+         TEST_ASSERT( r.error().sqlstate == "23505" );
+         TEST_ASSERT( !r.error().message.empty() );
+         TEST_ASSERT( r.error().detail.find( "(a)=(x)" ) != std::string::npos );
+         TEST_THROWS( (void)r.value() );
+         std::string thrown;
+         try {
+            connection->execute( "INSERT INTO tao_exception_test VALUES ( $1, $2 )", "x", "z" );
+         }
+         catch( const tao::pq::unique_violation& e ) {
+            thrown = e.what();
+         }
+         TEST_ASSERT( r.error().what == thrown );
+         try {
+            r.error().raise();
+         }
+         catch( const tao::pq::unique_violation& e ) {
+            TEST_ASSERT( e.sqlstate == "23505" );
+            TEST_ASSERT( std::string_view( e.what() ) == thrown );
+         }
+      }
+      {
+         const auto r = connection->try_execute( "INSERT INTO tao_exception_test VALUES ( $1, $2 )", "y", "z" );
+         TEST_ASSERT( r );
+         TEST_ASSERT( r->rows_affected() == 1 );
+         TEST_ASSERT( r.value().rows_affected() == 1 );
+      }
+      TEST_ASSERT( connection->try_execute( "SELECT COUNT(*) FROM tao_exception_test" )->as< int >() == 2 );
+      TEST_ASSERT( connection->try_execute( "SELECT 1/0" ).error().sqlstate == "22012" );
+
+      {
+         const auto tr = connection->transaction();
+         TEST_ASSERT( tr->try_execute( "SELECT a FROM tao_missing_table" ).error().sqlstate == "42P01" );
+         TEST_THROWS( tr->execute( "SELECT 42" ) );  // the transaction is aborted
+         tr->rollback();
+      }
+      TEST_ASSERT( connection->try_execute( "SELECT 42" )->as< int >() == 42 );
+      TEST_THROWS( (void)connection->try_execute( "" ) );  // not an error reported by the server
    }
 
 }  // namespace
@@ -7,10 +7,13 @@
 #include "utils/macros.hpp"
 
 #include <exception>
+#include <filesystem>
+#include <fstream>
 #include <ios>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <utility>
 
@@ -132,6 +135,90 @@ namespace
          const auto transaction = connection->transaction();
          TEST_THROWS( tao::pq::large_object::import_file( transaction, "" ) );
       }
+
+      {
+         const auto transaction = connection->transaction();
+         const auto oid = tao::pq::large_object::create( transaction );
+         {
+            tao::pq::large_object_ostream os( transaction, oid, std::ios_base::out, 64 );
+            TEST_ASSERT( os.buffer().buffer_size() == 64 );
+            for( int i = 0; i < 1000; ++i ) {
+               os << "line " << i << '\n';
+            }
+            os << std::string( 100, 'x' ) << '\n';
+            os.close();
+            TEST_ASSERT( os.good() );
+         }
+         {
+            tao::pq::large_object_istream is( transaction, oid, std::ios_base::in, 64 );
+            std::string line;
+            for( int i = 0; i < 1000; ++i ) {
+               TEST_ASSERT( std::getline( is, line ) );
+               TEST_ASSERT( line == "line " + std::to_string( i ) );
+            }
+            TEST_ASSERT( std::getline( is, line ) );
+            TEST_ASSERT( line == std::string( 100, 'x' ) );
+            TEST_ASSERT( !std::getline( is, line ) );
+            TEST_ASSERT( is.eof() );
+         }
+         {
+            tao::pq::large_object_streambuf buffer( transaction, oid, std::ios_base::in | std::ios_base::out, 16 );
+            std::iostream stream( &buffer );
+            std::string word;
+            TEST_ASSERT( stream >> word );
+            TEST_ASSERT( word == "line" );
+            TEST_ASSERT( stream.tellg() == 4 );
+            stream.seekp( 5 );
+            stream << "X";
+            stream.seekg( 0 );
+            std::getline( stream, word );
+            TEST_ASSERT( word == "line X" );
+            std::getline( stream, word );
+            TEST_ASSERT( word == "line 1" );
+            buffer.close();
+         }
+         TEST_THROWS( tao::pq::large_object_streambuf( tao::pq::large_object( transaction, oid, std::ios_base::in ), 0 ) );
+      }
+
+      {
+         const auto path = std::filesystem::temp_directory_path() / "tao_large_object_test.bin";
+         const auto path2 = std::filesystem::temp_directory_path() / "tao_large_object_test2.bin";
+         std::string data;
+         for( int i = 0; i < 100000; ++i ) {
+            data += std::to_string( i * i );
+         }
+         std::ofstream( path, std::ios_base::binary ) << data;
+
+         const auto transaction = connection->transaction();
+         for( const std::size_t chunk_size : { std::size_t( 1000 ), std::size_t( 4096 ), data.size(), tao::pq::large_object::default_chunk_size } ) {
+            const auto oid = tao::pq::large_object::import_file( transaction, path, chunk_size );
+            {
+               tao::pq::large_object lo( transaction, oid, std::ios_base::in );
+               TEST_ASSERT( lo.read< std::string >( data.size() + 1 ) == data );
+            }
+            tao::pq::large_object::export_file( transaction, oid, path2, chunk_size );
+            TEST_ASSERT( std::filesystem::file_size( path2 ) == data.size() );
+            TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::off );
+            TEST_ASSERT( connection->result_format() == tao::pq::result_format::text_format );
+         }
+         {
+            std::ifstream stream( path2, std::ios_base::binary );
+            std::string line;
+            std::getline( stream, line );
+            TEST_ASSERT( line == data );
+         }
+
+         std::ofstream( path, std::ios_base::binary | std::ios_base::trunc );
+         const auto empty = tao::pq::large_object::import_file( transaction, path, 1024 );
+         tao::pq::large_object::export_file( transaction, empty, path2, 1024 );
+         TEST_ASSERT( std::filesystem::file_size( path2 ) == 0 );
+
+         TEST_THROWS( tao::pq::large_object::import_file( transaction, path, 0 ) );
+         TEST_THROWS( tao::pq::large_object::export_file( transaction, empty, path2, 0 ) );
+         std::filesystem::remove( path );
+         std::filesystem::remove( path2 );
+         TEST_THROWS( tao::pq::large_object::import_file( transaction, path, 1024 ) );
+      }
    }
 
 }  // namespace
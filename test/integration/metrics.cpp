@@ -0,0 +1,139 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/getenv.hpp"
+#include "utils/macros.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tao/pq.hpp>
+
+namespace
+{
+   [[nodiscard]] auto find( const std::vector< tao::pq::metrics::statement_snapshot >& snapshot, const std::string& statement ) -> const tao::pq::metrics::statement_snapshot*
+   {
+      const auto it = std::find_if( snapshot.begin(), snapshot.end(), [ & ]( const auto& s ) { return s.statement == statement; } );
+      return ( it == snapshot.end() ) ? nullptr : &*it;
+   }
+
+   void run()
+   {
+      const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+
+      {
+         const auto connection = tao::pq::connection::create( connection_string );
+         tao::pq::metrics metrics( 3 );
+         metrics.attach( *connection );
+         TEST_ASSERT( connection->log_handler() == metrics.log_handler() );
+
+         for( int i = 0; i < 10; ++i ) {
+            TEST_ASSERT( connection->execute( "SELECT $1::INTEGER", i ).as< int >() == i );
+         }
+         connection->prepare( "my_stmt", "SELECT 42" );
+         connection->execute( "my_stmt" );
+         connection->execute( "my_stmt" );
+         TEST_THROWS( connection->execute( "SELECT 1/0" ) );
+
+         {
+            const auto pipeline = connection->pipeline();
+            pipeline->send( "SELECT 1" );
+            pipeline->send( "SELECT 1" );
+            pipeline->sync();
+            TEST_ASSERT( pipeline->get_result().as< int >() == 1 );
+            TEST_ASSERT( pipeline->get_result().as< int >() == 1 );
+            pipeline->consume_sync();
+            pipeline->finish();
+         }
+
+         // the maximum number of statements is reached
+         connection->execute( "SELECT 'other'" );
+
+         const auto snapshot = metrics.snapshot();
+         const auto* const select = find( snapshot, "SELECT $1::INTEGER" );
+         TEST_ASSERT( select != nullptr );
+         TEST_ASSERT( select->count == 10 );
+         TEST_ASSERT( select->errors == 0 );
+         TEST_ASSERT( select->total.count() == 10 );
+         TEST_ASSERT( select->total.max() >= select->wait.max() );
+         TEST_ASSERT( select->total.percentile( 50 ) > std::chrono::nanoseconds( 0 ) );
+
+         const auto* const prepared = find( snapshot, "my_stmt" );
+         TEST_ASSERT( prepared != nullptr );
+         TEST_ASSERT( prepared->count == 2 );
+
+         const auto* const error = find( snapshot, "SELECT 1/0" );
+         TEST_ASSERT( error != nullptr );
+         TEST_ASSERT( error->count == 1 );
+         TEST_ASSERT( error->errors == 1 );
+
+         const auto* const other = find( snapshot, tao::pq::metrics::other_statements );
+         TEST_ASSERT( other != nullptr );
+         TEST_ASSERT( other->count == 3 );
+
+         metrics.reset();
+         TEST_ASSERT( find( metrics.snapshot(), "my_stmt" )->count == 0 );
+      }
+
+      {
+         const auto pool = tao::pq::connection_pool::create( connection_string );
+         const tao::pq::metrics metrics;
+         metrics.attach( *pool );
+         pool->execute( "SELECT 1" );
+         pool->execute( "SELECT 1" );
+         const auto snapshot = metrics.snapshot();
+         TEST_ASSERT( find( snapshot, "SELECT 1" ) != nullptr );
+         TEST_ASSERT( find( snapshot, "SELECT 1" )->count == 2 );
+      }
+
+      // attaching keeps the hooks of the current log handler
+      {
+         const auto connection = tao::pq::connection::create( connection_string );
+         const auto log = std::make_shared< tao::pq::log >();
+         int sent = 0;
+         log->connection.send_query = [ & ]( tao::pq::connection& /*unused*/, const char* /*unused*/, int /*unused*/, const Oid* /*unused*/, const char* const* /*unused*/, const int* /*unused*/, const int* /*unused*/ ) {
+            ++sent;
+         };
+         connection->set_log_handler( log );
+         const tao::pq::metrics metrics;
+         metrics.attach( *connection );
+         TEST_ASSERT( connection->log_handler() != log );
+         TEST_ASSERT( connection->log_handler() != metrics.log_handler() );
+         TEST_ASSERT( !connection->log_handler()->connection.wait );
+         connection->execute( "SELECT 1" );
+         TEST_ASSERT( sent == 1 );
+         TEST_ASSERT( find( metrics.snapshot(), "SELECT 1" )->count == 1 );
+      }
+
+      TEST_ASSERT( tao::pq::chain( nullptr, nullptr ) == nullptr );
+      {
+         const auto log = std::make_shared< tao::pq::log >();
+         TEST_ASSERT( tao::pq::chain( log, nullptr ) == log );
+         TEST_ASSERT( tao::pq::chain( nullptr, log ) == log );
+         TEST_ASSERT( tao::pq::chain( log, log ) == log );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
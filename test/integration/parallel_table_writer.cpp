@@ -0,0 +1,128 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/getenv.hpp"
+#include "utils/macros.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <tao/pq.hpp>
+
+namespace
+{
+   void run()
+   {
+      const auto pool = tao::pq::connection_pool::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+      pool->execute( "DROP TABLE IF EXISTS tao_parallel_table_writer_test" );
+      pool->execute( "CREATE TABLE tao_parallel_table_writer_test ( a INTEGER NOT NULL, b TEXT )" );
+
+      TEST_THROWS( tao::pq::parallel_table_writer( pool, 0, "COPY tao_parallel_table_writer_test ( a, b ) FROM STDIN" ) );
+      TEST_THROWS( tao::pq::parallel_table_writer( pool, 2, "SELECT 42" ) );
+
+      // independent commits
+      {
+         tao::pq::parallel_table_writer tw( pool, 4, "COPY tao_parallel_table_writer_test ( a, b ) FROM STDIN" );
+         TEST_ASSERT( tw.shards() == 4 );
+         TEST_ASSERT( tw.commit_mode() == tao::pq::commit_mode::independent );
+         for( int n = 0; n < 10000; ++n ) {
+            tw.insert( n, "FOO" );
+         }
+         tw.insert_raw( "10000\tBAR\n" );
+         tw.shard( 3 ).insert( 10001, tao::pq::null );
+         TEST_THROWS( tw.shard( 4 ) );
+         TEST_ASSERT( tw.commit() == 10002 );
+         TEST_THROWS( tw.commit() );
+         TEST_THROWS( tw.insert( 1, "FOO" ) );
+      }
+      TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM tao_parallel_table_writer_test" ).as< std::size_t >() == 10002 );
+      TEST_ASSERT( pool->execute( "SELECT COUNT(DISTINCT a) FROM tao_parallel_table_writer_test" ).as< std::size_t >() == 10002 );
+
+      // no commit, everything is rolled back
+      {
+         tao::pq::parallel_table_writer tw( pool, 3, "COPY tao_parallel_table_writer_test ( a, b ) FROM STDIN" );
+         for( int n = 0; n < 100; ++n ) {
+            tw.insert( n, "BAZ" );
+         }
+      }
+      TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM tao_parallel_table_writer_test" ).as< std::size_t >() == 10002 );
+
+      // a failing shard
+      {
+         tao::pq::parallel_table_writer tw( pool, 2, "COPY tao_parallel_table_writer_test ( a, b ) FROM STDIN", tao::pq::commit_mode::two_phase );
+         tw.insert( 1, "FOO" );
+         tw.insert_raw( "NOT A NUMBER\tFOO\n" );
+         TEST_THROWS( tw.commit() );
+      }
+      TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM tao_parallel_table_writer_test" ).as< std::size_t >() == 10002 );
+
+      // a commit that fails after another shard was committed, the deferred constraint is only checked by COMMIT
+      pool->execute( "DROP TABLE IF EXISTS tao_parallel_table_writer_partial" );
+      pool->execute( "CREATE TABLE tao_parallel_table_writer_partial ( a INTEGER NOT NULL UNIQUE DEFERRABLE INITIALLY DEFERRED )" );
+      {
+         tao::pq::parallel_table_writer tw( pool, 3, "COPY tao_parallel_table_writer_partial ( a ) FROM STDIN" );
+         tw.shard( 0 ).insert( 1 );
+         tw.shard( 0 ).insert( 2 );
+         tw.shard( 1 ).insert( 3 );
+         tw.shard( 1 ).insert( 3 );
+         tw.shard( 2 ).insert( 4 );
+         bool caught = false;
+         try {
+            std::ignore = tw.commit();
+         }
+         catch( const tao::pq::partial_commit_error& e ) {
+            caught = true;
+            TEST_ASSERT( e.shards == std::vector< std::size_t >{ 0 } );
+            TEST_ASSERT( e.rows == 2 );
+         }
+         TEST_ASSERT( caught );
+         TEST_THROWS( tw.commit() );
+      }
+      TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM tao_parallel_table_writer_partial" ).as< std::size_t >() == 2 );
+
+      // the first commit fails, nothing is committed
+      {
+         tao::pq::parallel_table_writer tw( pool, 2, "COPY tao_parallel_table_writer_partial ( a ) FROM STDIN" );
+         tw.shard( 0 ).insert( 5 );
+         tw.shard( 0 ).insert( 5 );
+         tw.shard( 1 ).insert( 6 );
+         TEST_THROWS( tw.commit() );
+      }
+      TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM tao_parallel_table_writer_partial" ).as< std::size_t >() == 2 );
+
+      // two-phase commit requires max_prepared_transactions > 0
+      if( pool->execute( "SHOW max_prepared_transactions" ).as< int >() > 0 ) {
+         tao::pq::parallel_table_writer tw( pool, 2, "COPY tao_parallel_table_writer_test ( a, b ) FROM STDIN ( FORMAT binary )", tao::pq::commit_mode::two_phase );
+         TEST_ASSERT( tw.is_binary() );
+         for( int n = 0; n < 1000; ++n ) {
+            tw.insert( n, "FOO" );
+         }
+         TEST_ASSERT( tw.commit() == 1000 );
+         TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM tao_parallel_table_writer_test" ).as< std::size_t >() == 11002 );
+         TEST_ASSERT( pool->execute( "SELECT COUNT(*) FROM pg_prepared_xacts WHERE gid LIKE 'taopq_%'" ).as< std::size_t >() == 0 );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
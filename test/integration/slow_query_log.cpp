@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/getenv.hpp"
+#include "utils/macros.hpp"
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <tao/pq.hpp>
+
+namespace
+{
+   void run()
+   {
+      const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+      const auto connection = tao::pq::connection::create( connection_string );
+
+      using namespace std::chrono_literals;
+
+      std::mutex mutex;
+      std::vector< tao::pq::slow_query > queries;
+      const auto writer = [ & ]( const tao::pq::slow_query& q ) {
+         const std::lock_guard lock( mutex );
+         queries.push_back( q );
+      };
+
+      {
+         tao::pq::slow_query_options options;
+         options.threshold = 100ms;
+         options.max_parameter_size = 4;
+         tao::pq::slow_query_log log( writer, options );
+         log.attach( *connection );
+
+         connection->execute( "SELECT 1" );
+         connection->execute( "SELECT pg_sleep( .2 ), $1::TEXT, $2::TEXT, $3::TEXT", "abc", "abcdefgh", tao::pq::null );
+         connection->execute( "SELECT pg_sleep( .2 ), $1", tao::pq::binary{ std::byte( 1 ), std::byte( 0xab ), std::byte( 2 ) } );
+         TEST_THROWS( connection->execute( "SELECT pg_sleep( .2 ), 1/0" ) );
+         TEST_ASSERT( log.dropped() == 0 );
+      }
+
+      TEST_ASSERT( queries.size() == 3 );
+      {
+         const auto& q = queries[ 0 ];
+         TEST_ASSERT( q.statement == "SELECT pg_sleep( .2 ), $1::TEXT, $2::TEXT, $3::TEXT" );
+         TEST_ASSERT( q.duration >= 200ms );
+         TEST_ASSERT( q.parameters.size() == 3 );
+         TEST_ASSERT( q.parameters[ 0 ] == "abc" );
+         TEST_ASSERT( q.parameters[ 1 ] == "abcd..." );
+         TEST_ASSERT( !q.parameters[ 2 ] );
+         TEST_ASSERT( q.rows == 1 );
+         TEST_ASSERT( q.backend_pid == PQbackendPID( connection->underlying_raw_ptr() ) );
+         TEST_ASSERT( !q.error );
+         TEST_ASSERT( !q.sampled );
+
+         const auto line = tao::pq::to_string( q );
+         TEST_ASSERT( line.find( " rows=1 statement=\"SELECT pg_sleep( .2 ), $1::TEXT, $2::TEXT, $3::TEXT\" parameters=[\"abc\",\"abcd...\",NULL]" ) != std::string::npos );
+      }
+      TEST_ASSERT( queries[ 1 ].parameters.size() == 1 );
+      TEST_ASSERT( queries[ 1 ].parameters[ 0 ] == "\\x01ab..." );
+      TEST_ASSERT( queries[ 2 ].error );
+
+      queries.clear();
+      connection->reset_log_handler();
+      {
+         tao::pq::slow_query_options options;
+         options.threshold = 1h;
+         options.sample_rate = 1.0;
+         tao::pq::slow_query_log log( writer, options );
+         log.attach( *connection );
+
+         connection->execute( "SELECT 1" );
+         connection->prepare( "my_stmt", "SELECT generate_series( 1, 3 )" );
+         connection->execute( "my_stmt" );
+      }
+
+      TEST_ASSERT( queries.size() == 2 );
+      TEST_ASSERT( queries[ 0 ].sampled );
+      TEST_ASSERT( queries[ 1 ].statement == "my_stmt" );
+      TEST_ASSERT( queries[ 1 ].rows == 3 );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -6,16 +6,57 @@
 #include "utils/getenv.hpp"
 #include "utils/macros.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <exception>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <optional>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <vector>
+
+#if defined( _WIN32 )
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include <tao/pq.hpp>
 
 namespace
 {
+   // views would dangle once the table_reader moves on to the next row
+   template< typename... Ts >
+   concept batchable = requires { typename tao::pq::column_batch< Ts... >; };
+
+   static_assert( batchable< int, double, std::string > );
+   static_assert( !batchable< int, std::string_view > );
+   static_assert( !batchable< const char* > );
+
+   [[nodiscard]] auto open_file( const std::filesystem::path& path ) -> int
+   {
+#if defined( _WIN32 )
+      return ::_open( path.string().c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE );
+#else
+      return ::open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600 );  // NOLINT(cppcoreguidelines-pro-type-vararg)
+#endif
+   }
+
+   void close_file( const int fd )
+   {
+#if defined( _WIN32 )
+      ::_close( fd );
+#else
+      ::close( fd );
+#endif
+   }
+
    void run()
    {
       const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
@@ -47,6 +88,65 @@ namespace
          TEST_ASSERT_MESSAGE( "validate count", count == 300000 );
       }
 
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT" );
+         TEST_ASSERT( tr.read_ahead() == 0 );
+         tr.set_read_ahead( 16 );
+         TEST_ASSERT( tr.read_ahead() == 16 );
+
+         unsigned n = 0;
+         for( const auto& row : tr ) {
+            TEST_ASSERT( row.get< unsigned >( 0 ) == n++ );
+            TEST_THROWS( tr.set_read_ahead( 0 ) );
+         }
+         TEST_ASSERT_MESSAGE( "validate count", n == 100000 );
+         TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+      }
+
+      {
+         const auto path = std::filesystem::temp_directory_path() / "tao_table_reader_test.txt";
+         {
+            const int fd = open_file( path );
+            TEST_ASSERT( fd >= 0 );
+            tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT" );
+            const auto result = tr.copy_to_fd( fd );
+            close_file( fd );
+            TEST_ASSERT( result.rows == 100000 );
+            TEST_ASSERT( result.bytes == std::filesystem::file_size( path ) );
+            TEST_ASSERT( tr.copy_to_fd( fd ).bytes == 0 );
+         }
+         {
+            std::ifstream stream( path );
+            std::string line;
+            std::getline( stream, line );
+            TEST_ASSERT( line == "0\t0\tEUR" );
+         }
+         {
+            const int fd = open_file( path );
+            tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT ( FORMAT binary )" );
+            tr.set_read_ahead( 64 );
+            const auto result = tr.copy_to_fd( fd );
+            close_file( fd );
+            TEST_ASSERT( result.rows == 100000 );
+            TEST_ASSERT( result.bytes == std::filesystem::file_size( path ) );
+         }
+         {
+            // a binary file written by copy_to_fd() can be read by insert_file()
+            tao::pq::table_writer tw( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) FROM STDIN ( FORMAT binary )" );
+            std::ignore = tw.insert_file( path, true );
+            TEST_ASSERT( tw.commit() == 100000 );
+         }
+         {
+            tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT" );
+            TEST_ASSERT( tr.get_row() );
+            TEST_THROWS( tr.copy_to_fd( -1 ) );
+            for( const auto& row : tr ) {
+               std::ignore = row;
+            }
+         }
+         std::filesystem::remove( path );
+      }
+
       TEST_THROWS( tao::pq::table_reader( connection->direct(), "SELECT 42" ) );
       TEST_THROWS( tao::pq::table_reader( connection->direct(), "" ) );
       TEST_THROWS( tao::pq::table_reader( connection->direct(), "COPY tao_table_reader_test ( a, b, c, d ) TO STDOUT" ) );
@@ -114,6 +214,127 @@ namespace
          PQclear( PQexec( connection->underlying_raw_ptr(), "SELECT 42" ) );
          TEST_THROWS( tr.get_row() );
       }
+
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT ( FORMAT binary )" );
+         TEST_ASSERT( tr.is_binary() );
+         TEST_ASSERT( tr.columns() == 3 );
+         {
+            TEST_ASSERT( tr.get_row() );
+            const auto& row = tr.row();
+            TEST_ASSERT( row.format( 0 ) == tao::pq::result_format::binary_format );
+            auto [ a, b, c ] = row.tuple< int, std::optional< double >, std::optional< std::string > >();
+            TEST_ASSERT( a == 1 );
+            TEST_ASSERT( b == 1.234567 );
+            TEST_ASSERT( c == "A\bB\fC\"D'E\n\rF\tGH\vI\\J" );
+            TEST_ASSERT( row[ 0 ].length() == 4 );
+            TEST_ASSERT( row[ 1 ].length() == 8 );
+            TEST_THROWS( row.get< long long >( 0 ) );
+            TEST_THROWS( row.get< unsigned >( 0 ) );
+         }
+         {
+            TEST_ASSERT( tr.get_row() );
+            const auto& row = tr.row();
+            TEST_ASSERT( row.get< int >( 0 ) == 2 );
+            TEST_ASSERT( row.is_null( 1 ) );
+            TEST_ASSERT( row[ 2 ] == tao::pq::null );
+            TEST_THROWS( row.length( 1 ) );
+         }
+         TEST_ASSERT( tr.get_row() );
+         TEST_ASSERT( tr.row().tuple< int, double, std::string >() == std::tuple< int, double, std::string >( 3, 42, "FOO" ) );
+         TEST_ASSERT( !tr.get_row() );
+      }
+
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT" );
+         TEST_THROWS( tr.read_batch< int, double >( 2 ) );
+
+         tao::pq::column_batch< int, double, std::string > batch;
+         TEST_ASSERT( tr.read_batch( batch, 2 ) == 2 );
+         TEST_ASSERT( batch.size() == 2 );
+         TEST_ASSERT( ( batch.values< 0 >() == std::vector< int >{ 1, 2 } ) );
+         TEST_ASSERT( batch.values< 1 >()[ 0 ] == 1.234567 );
+         TEST_ASSERT( !batch.is_null< 1 >( 0 ) );
+         TEST_ASSERT( batch.is_null< 1 >( 1 ) );
+         TEST_ASSERT( batch.values< 1 >()[ 1 ] == 0 );
+         TEST_ASSERT( ( batch.nulls< 2 >() == std::vector< std::uint8_t >{ 0, 1 } ) );
+
+         TEST_ASSERT( tr.read_batch( batch, 2 ) == 1 );
+         TEST_ASSERT( batch.values< 0 >()[ 0 ] == 3 );
+         TEST_ASSERT( batch.values< 2 >()[ 0 ] == "FOO" );
+         TEST_ASSERT( tr.read_batch( batch, 2 ) == 0 );
+         TEST_ASSERT( batch.empty() );
+      }
+
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT ( FORMAT binary )" );
+         const auto batch = tr.read_batch< int, double, std::string >( 10 );
+         TEST_ASSERT( batch.size() == 3 );
+         TEST_ASSERT( batch.values< 2 >()[ 2 ] == "FOO" );
+         TEST_ASSERT( batch.is_null< 2 >( 1 ) );
+      }
+
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT ( FORMAT csv )" );
+         tr.set_csv();
+         const auto result = tr.vector< std::tuple< int, std::optional< double >, std::optional< std::string > > >();
+         TEST_ASSERT( result.size() == 3 );
+         TEST_ASSERT( std::get< 2 >( result[ 0 ] ) == "A\bB\fC\"D'E\n\rF\tGH\vI\\J" );
+         TEST_ASSERT( !std::get< 1 >( result[ 1 ] ) );
+         TEST_ASSERT( !std::get< 2 >( result[ 1 ] ) );
+         TEST_ASSERT( std::get< 2 >( result[ 2 ] ) == "FOO" );
+      }
+
+      {
+         connection->execute( "UPDATE tao_table_reader_test SET c = '' WHERE a = 3" );
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, c ) TO STDOUT ( FORMAT csv, DELIMITER '|', QUOTE '''', NULL 'NULL' )" );
+         tr.set_csv( { '|', '\'', "NULL" } );
+         const auto result = tr.map< int, std::optional< std::string > >();
+         TEST_ASSERT( result.size() == 3 );
+         TEST_ASSERT( !result.at( 2 ) );
+         TEST_ASSERT( result.at( 3 ) == "" );
+      }
+
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT ( FORMAT binary )" );
+         TEST_THROWS( tr.set_csv() );
+      }
+
+      {
+         // CSV options that do not match the COPY statement, the reader is left in the middle of the COPY
+         const auto other = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+         tao::pq::table_reader tr( other->direct(), "COPY ( SELECT '\"a' ) TO STDOUT ( FORMAT csv, QUOTE '''' )" );
+         tr.set_csv();
+         TEST_THROWS( tr.get_row() );
+      }
+
+      {
+         connection->execute( "DELETE FROM tao_table_reader_test" );
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT ( FORMAT binary )" );
+         TEST_ASSERT( tr.vector< std::tuple< int, std::optional< double >, std::optional< std::string > > >().empty() );
+      }
+
+      // destroyed while the background thread is still receiving
+      connection->execute( "INSERT INTO tao_table_reader_test SELECT generate_series( 1, 10000 ), 0, 'FOO'" );
+      {
+         tao::pq::table_reader tr( connection->direct(), "COPY tao_table_reader_test ( a, b, c ) TO STDOUT" );
+         tr.set_read_ahead( 4 );
+         TEST_ASSERT( tr.get_row() );
+         TEST_ASSERT( tr.get_row() );
+      }
+
+      // destroyed while the background thread waits for a slow query
+      {
+         const auto other = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+         const auto start = std::chrono::steady_clock::now();
+         {
+            tao::pq::table_reader tr( other->direct(), "COPY ( SELECT n, pg_sleep( CASE WHEN n = 2 THEN 60 ELSE 0 END ) FROM generate_series( 1, 2 ) n ) TO STDOUT" );
+            tr.set_read_ahead( 4 );
+            TEST_ASSERT( tr.get_row() );
+            TEST_ASSERT( tr.row().get< int >( 0 ) == 1 );
+         }
+         TEST_ASSERT( std::chrono::steady_clock::now() - start < std::chrono::seconds( 30 ) );
+      }
    }
 
 }  // namespace
@@ -4,8 +4,11 @@
 
 #include <cstddef>
 #include <exception>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <optional>
+#include <string>
 #include <tuple>
 
 #include "utils/getenv.hpp"
@@ -15,6 +18,11 @@
 
 namespace
 {
+   void write_file( const std::filesystem::path& path, const std::string& data )
+   {
+      std::ofstream( path, std::ios::binary ) << data;
+   }
+
    void run()
    {
       const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
@@ -40,6 +48,20 @@ namespace
          TEST_ASSERT_MESSAGE( "checking 'c' value", c == "EUR\nUSD\"FOO\\BAR" );
       }
 
+      {
+         tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN" );
+         TEST_ASSERT( tw2.flush_threshold() == tao::pq::table_writer::default_flush_threshold );
+         tw2.set_flush_threshold( 100 );
+         TEST_ASSERT( tw2.flush_threshold() == 100 );
+         for( unsigned n = 0; n < 1000; ++n ) {
+            tw2.insert( n, n + 0.5, "USD" );
+         }
+         tw2.insert_raw( "1\t2\t" + std::string( 1000, 'x' ) + '\n' );
+         tw2.reset_flush_threshold();
+         TEST_ASSERT( tw2.flush_threshold() == tao::pq::table_writer::default_flush_threshold );
+         TEST_ASSERT( tw2.commit() == 1001 );
+      }
+
       TEST_THROWS( tao::pq::table_writer( connection->direct(), "SELECT 42" ) );
       TEST_THROWS( tao::pq::table_writer( connection->direct(), "" ) );
       TEST_THROWS( tao::pq::table_writer( connection->direct(), "COPY tao_table_writer_test ( a, b, c, d ) FROM STDIN" ) );
@@ -83,10 +105,154 @@ namespace
       }
       {
          tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN" );
+         tw2.set_flush_threshold( 0 );
          tw2.insert_raw( "4\t0\tXXX\n" );
          PQclear( PQexec( connection->underlying_raw_ptr(), "SELECT 42" ) );
          TEST_THROWS( tw2.insert_raw( "5\t0\tXXX\n" ) );
       }
+      {
+         tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN" );
+         tw2.insert_raw( "4\t0\tXXX\n" );
+         tw2.flush();
+         PQclear( PQexec( connection->underlying_raw_ptr(), "SELECT 42" ) );
+         tw2.insert_raw( "5\t0\tXXX\n" );
+         TEST_THROWS( tw2.flush() );
+      }
+
+      connection->execute( "DROP TABLE tao_table_writer_test" );
+      connection->execute( "CREATE TABLE tao_table_writer_test ( a INTEGER NOT NULL, b DOUBLE PRECISION, c TEXT )" );
+      {
+         tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN ( FORMAT binary )" );
+         TEST_ASSERT( tw2.is_binary() );
+         for( int n = 0; n < 1000; ++n ) {
+            tw2.insert( n, n + 0.5, "EUR\tUSD" );
+         }
+         tw2.insert( std::make_tuple( 1000, tao::pq::null, std::optional< std::string >() ) );
+         TEST_THROWS( tw2.insert( 1U, 1.0, "XXX" ) );
+         TEST_ASSERT( tw2.commit() == 1001 );
+      }
+      TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_table_writer_test" ).as< std::size_t >() == 1001 );
+      TEST_ASSERT( connection->execute( "SELECT c FROM tao_table_writer_test WHERE a = 42 AND b = 42.5" ).as< std::string >() == "EUR\tUSD" );
+      TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_table_writer_test WHERE b IS NULL AND c IS NULL" ).as< std::size_t >() == 1 );
+      {
+         tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN" );
+         TEST_ASSERT( !tw2.is_binary() );
+      }
+
+      connection->execute( "DELETE FROM tao_table_writer_test" );
+      {
+         tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN ( FORMAT csv, DELIMITER ';', NULL 'NULL' )" );
+         TEST_ASSERT( !tw2.csv() );
+         tw2.set_csv( { ';', '"', "NULL" } );
+         TEST_ASSERT( tw2.csv()->delimiter == ';' );
+         tw2.insert( 1, 1.5, "a;b\"c\nd" );
+         tw2.insert( 2, tao::pq::null, "NULL" );
+         tw2.insert( 3, 3.5, "" );
+         tw2.insert_raw( "4;NULL;NULL\n" );
+         TEST_ASSERT( tw2.commit() == 4 );
+      }
+      TEST_ASSERT( connection->execute( "SELECT c FROM tao_table_writer_test WHERE a = 1 AND b = 1.5" ).as< std::string >() == "a;b\"c\nd" );
+      TEST_ASSERT( connection->execute( "SELECT c FROM tao_table_writer_test WHERE a = 2 AND b IS NULL" ).as< std::string >() == "NULL" );
+      TEST_ASSERT( connection->execute( "SELECT c FROM tao_table_writer_test WHERE a = 3" ).as< std::string >().empty() );
+      TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_table_writer_test WHERE a = 4 AND b IS NULL AND c IS NULL" ).as< std::size_t >() == 1 );
+      {
+         tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN ( FORMAT binary )" );
+         TEST_THROWS( tw2.set_csv() );
+      }
+
+      connection->execute( "DELETE FROM tao_table_writer_test" );
+      {
+         const auto path = std::filesystem::temp_directory_path() / "tao_table_writer_test.txt";
+         std::string data;
+         for( int n = 0; n < 100000; ++n ) {
+            data += std::to_string( n ) + "\t" + std::to_string( n ) + ".5\tEUR\n";
+         }
+         write_file( path, data );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN" );
+            TEST_ASSERT( tw2.columns() == 3 );
+            std::size_t calls = 0;
+            std::size_t last = 0;
+            TEST_ASSERT( tw2.insert_file( path, true, [ & ]( const std::size_t sent, const std::size_t total ) {
+               ++calls;
+               last = sent;
+               TEST_ASSERT( total == data.size() );
+            } ) == data.size() );
+            TEST_ASSERT( calls > 1 );
+            TEST_ASSERT( last == data.size() );
+            TEST_ASSERT( tw2.commit() == 100000 );
+         }
+         TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_table_writer_test" ).as< std::size_t >() == 100000 );
+
+         write_file( path, "1\t1.5\tEUR\n2\t2.5\n" );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, b, c ) FROM STDIN" );
+            TEST_THROWS( tw2.insert_file( path, true ) );
+         }
+
+         write_file( path, "1;\"a;b\"\n2;NULL\n" );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test ( a, c ) FROM STDIN ( FORMAT csv, DELIMITER ';', NULL 'NULL' )" );
+            tw2.set_csv( { ';', '"', "NULL" } );
+            TEST_ASSERT( tw2.insert_file( path, true ) == 15 );
+            TEST_ASSERT( tw2.commit() == 2 );
+         }
+         TEST_ASSERT( connection->execute( "SELECT c FROM tao_table_writer_test WHERE a = 1 AND b IS NULL" ).as< std::string >() == "a;b" );
+
+         connection->execute( "DELETE FROM tao_table_writer_test" );
+         connection->execute( "INSERT INTO tao_table_writer_test VALUES ( 1, 1.5, 'EUR' ), ( 2, NULL, NULL )" );
+         {
+            tao::pq::table_reader tr( connection->direct(), "COPY tao_table_writer_test TO STDOUT ( FORMAT binary )" );
+            data.clear();
+            // the reader skips header and trailer, so rebuild them around the raw rows
+            data.append( "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19 );
+            for( auto row = tr.get_raw_data(); !row.empty(); row = tr.get_raw_data() ) {
+               data += row;
+            }
+            data.append( "\377\377", 2 );
+         }
+         write_file( path, data );
+         connection->execute( "DELETE FROM tao_table_writer_test" );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test FROM STDIN ( FORMAT binary )" );
+            TEST_ASSERT( tw2.insert_file( path, true ) == data.size() - 21 );
+            TEST_ASSERT( tw2.commit() == 2 );
+         }
+         TEST_ASSERT( connection->execute( "SELECT c FROM tao_table_writer_test WHERE a = 1 AND b = 1.5" ).as< std::string >() == "EUR" );
+
+         // a field length below -1 is neither NULL nor a value
+         data.assign( "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19 );
+         data.append( "\0\3", 2 );
+         for( int i = 0; i != 3; ++i ) {
+            data.append( "\377\377\377\376", 4 );
+         }
+         data.append( "\377\377", 2 );
+         write_file( path, data );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test FROM STDIN ( FORMAT binary )" );
+            TEST_THROWS( tw2.insert_file( path, true ) );
+         }
+
+         // a file written WITH OIDS carries an extra field in every row
+         data.assign( "PGCOPY\n\377\r\n\0\0\1\0\0\0\0\0\0", 19 );
+         data.append( "\377\377", 2 );
+         write_file( path, data );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test FROM STDIN ( FORMAT binary )" );
+            TEST_THROWS( tw2.insert_file( path ) );
+         }
+
+         write_file( path, "not a binary file" );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test FROM STDIN ( FORMAT binary )" );
+            TEST_THROWS( tw2.insert_file( path ) );
+         }
+         std::filesystem::remove( path );
+         {
+            tao::pq::table_writer tw2( connection->direct(), "COPY tao_table_writer_test FROM STDIN" );
+            TEST_THROWS( tw2.insert_file( path ) );
+         }
+      }
 
       connection->execute( "DROP TABLE tao_table_writer_test" );
    }
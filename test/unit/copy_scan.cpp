@@ -0,0 +1,97 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <tao/pq/internal/copy_scan.hpp>
+
+namespace
+{
+   // reference implementation
+   [[nodiscard]] auto expected( const std::string& row, bool& escaped ) -> std::vector< std::size_t >
+   {
+      std::vector< std::size_t > result;
+      escaped = false;
+      for( std::size_t i = 0; i != row.size(); ++i ) {
+         switch( row[ i ] ) {
+            case '\\':
+               escaped = true;
+               [[fallthrough]];
+            case '\t':
+               result.push_back( i );
+               break;
+
+            case '\n':
+               result.push_back( i );
+               return result;
+
+            default:
+               break;
+         }
+      }
+      return result;
+   }
+
+   void check( const std::string& row )
+   {
+      bool escaped;
+      const auto positions = expected( row, escaped );
+      std::vector< std::size_t > result;
+      TEST_ASSERT( tao::pq::internal::scan_copy_row( row.data(), row.size(), result ) == escaped );
+      TEST_ASSERT( result == positions );
+   }
+
+   void run()
+   {
+      check( "" );
+      check( "\n" );
+      check( "a\tb\tc\n" );
+      check( "\\N\t\\N\n" );
+      check( "a\\\\b\tc\\td\n" );
+      check( "a\tb\nc\td\n" );
+
+      // cover the vectorised paths and their tails at every alignment
+      for( std::size_t n = 0; n != 100; ++n ) {
+         std::string row;
+         for( std::size_t i = 0; i != n; ++i ) {
+            row += ( i % 7 == 0 ) ? '\t' : static_cast< char >( 'a' + i % 26 );
+         }
+         check( row + '\n' );
+         check( row + "\\n\n" );
+         check( row + '\n' + row + '\n' );
+         check( '\\' + row + '\n' );
+      }
+
+      {
+         const std::string row( 1000, 'x' );
+         std::vector< std::size_t > result;
+         TEST_ASSERT( !tao::pq::internal::scan_copy_row( ( row + '\n' ).c_str(), row.size() + 1, result ) );
+         TEST_ASSERT( result == std::vector< std::size_t >{ 1000 } );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
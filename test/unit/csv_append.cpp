@@ -0,0 +1,81 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <tao/pq/csv_options.hpp>
+#include <tao/pq/table_writer.hpp>
+
+namespace
+{
+   [[nodiscard]] auto csv( const std::string_view value, const tao::pq::csv_options& options = {} ) -> std::string
+   {
+      std::string result;
+      tao::pq::internal::csv_append( result, value, options );
+      return result;
+   }
+
+   [[nodiscard]] auto csv_text( const std::string_view field, const tao::pq::csv_options& options = {} ) -> std::string
+   {
+      std::string result;
+      std::string copy( field );
+      tao::pq::internal::csv_append_text( result, copy, options );
+      return result;
+   }
+
+   void run()
+   {
+      TEST_ASSERT( csv( "42" ) == "42" );
+      TEST_ASSERT( csv( "FOO BAR" ) == "FOO BAR" );
+      TEST_ASSERT( csv( "" ) == "\"\"" );
+      TEST_ASSERT( csv( "a,b" ) == "\"a,b\"" );
+      TEST_ASSERT( csv( "a\"b" ) == "\"a\"\"b\"" );
+      TEST_ASSERT( csv( "a\nb" ) == "\"a\nb\"" );
+      TEST_ASSERT( csv( "a\rb" ) == "\"a\rb\"" );
+      TEST_ASSERT( csv( "a\tb\\c" ) == "a\tb\\c" );
+      TEST_ASSERT( csv( "\\N" ) == "\\N" );
+      TEST_ASSERT( csv( "\\." ) == "\"\\.\"" );
+      TEST_ASSERT( csv( "\\.x" ) == "\\.x" );
+
+      TEST_ASSERT( csv_text( "42" ) == "42" );
+      TEST_ASSERT( csv_text( "\\N" ) == "" );
+      TEST_ASSERT( csv_text( "" ) == "\"\"" );
+      TEST_ASSERT( csv_text( "a\\nb" ) == "\"a\nb\"" );
+      TEST_ASSERT( csv_text( "a\\tb\\\\c" ) == "a\tb\\c" );
+      TEST_ASSERT( csv_text( "\\\\x0102" ) == "\\x0102" );
+      TEST_ASSERT( csv_text( "\\\\." ) == "\"\\.\"" );
+      TEST_THROWS( csv_text( "abc\\" ) );
+
+      const tao::pq::csv_options options{ ';', '\'', "NULL" };
+      TEST_ASSERT( csv_text( "\\N", options ) == "NULL" );
+      TEST_ASSERT( csv( "NULL", options ) == "'NULL'" );
+      TEST_ASSERT( csv( "", options ) == "''" );
+      TEST_ASSERT( csv( "a,b", options ) == "a,b" );
+      TEST_ASSERT( csv( "a;b", options ) == "'a;b'" );
+      TEST_ASSERT( csv( "it's", options ) == "'it''s'" );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
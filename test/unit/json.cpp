@@ -0,0 +1,50 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <tao/pq/internal/json.hpp>
+
+namespace
+{
+   [[nodiscard]] auto json( const std::string_view value ) -> std::string
+   {
+      std::string result = "x";
+      tao::pq::internal::append_json( result, value );
+      return result;
+   }
+
+   void run()
+   {
+      TEST_ASSERT( json( "" ) == "x\"\"" );
+      TEST_ASSERT( json( "SELECT 1" ) == "x\"SELECT 1\"" );
+      TEST_ASSERT( json( "a\"b\\c" ) == "x\"a\\\"b\\\\c\"" );
+      TEST_ASSERT( json( "\n\r\t" ) == "x\"\\n\\r\\t\"" );
+      TEST_ASSERT( json( std::string_view( "\0\x1f", 2 ) ) == "x\"\\u0000\\u001f\"" );
+      TEST_ASSERT( json( "\xc3\xa4" ) == "x\"\xc3\xa4\"" );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
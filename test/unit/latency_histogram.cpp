@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+
+#include <tao/pq/metrics.hpp>
+
+namespace
+{
+   using tao::pq::latency_histogram;
+
+   void run()
+   {
+      static_assert( latency_histogram::index( 0 ) == 0 );
+      static_assert( latency_histogram::index( 15 ) == 15 );
+      static_assert( latency_histogram::index( 16 ) == 16 );
+      static_assert( latency_histogram::index( 31 ) == 31 );
+      static_assert( latency_histogram::index( 32 ) == 32 );
+      static_assert( latency_histogram::index( 33 ) == 32 );
+      static_assert( latency_histogram::index( 34 ) == 33 );
+      static_assert( latency_histogram::index( UINT64_MAX ) == latency_histogram::buckets - 1 );
+
+      // the last bucket ends at the clamp, which is about 137 seconds
+      static_assert( latency_histogram::max_value == ( std::uint64_t( 1 ) << 37 ) - 1 );
+      static_assert( std::chrono::nanoseconds( latency_histogram::max_value ) > std::chrono::seconds( 137 ) );
+      static_assert( std::chrono::nanoseconds( latency_histogram::max_value ) < std::chrono::seconds( 138 ) );
+      static_assert( latency_histogram::upper_bound( latency_histogram::buckets - 1 ) == latency_histogram::max_value );
+      static_assert( latency_histogram::upper_bound( latency_histogram::buckets - 2 ) < latency_histogram::max_value );
+      static_assert( latency_histogram::index( latency_histogram::max_value ) == latency_histogram::buckets - 1 );
+      static_assert( latency_histogram::index( latency_histogram::max_value + 1 ) == latency_histogram::buckets - 1 );
+      static_assert( latency_histogram::index( latency_histogram::upper_bound( latency_histogram::buckets - 2 ) ) == latency_histogram::buckets - 2 );
+
+      // every value lies within the bounds of its bucket
+      for( std::uint64_t v = 0; v < ( std::uint64_t( 1 ) << 36 ); v = ( v * 9 / 8 ) + 1 ) {
+         const auto i = latency_histogram::index( v );
+         TEST_ASSERT( i < latency_histogram::buckets );
+         TEST_ASSERT( latency_histogram::upper_bound( i ) >= v );
+         TEST_ASSERT( ( i == 0 ) || ( latency_histogram::upper_bound( i - 1 ) < v ) );
+         TEST_ASSERT( latency_histogram::upper_bound( i ) - v <= v / 16 );
+      }
+
+      latency_histogram h;
+      TEST_ASSERT( h.get_snapshot().count() == 0 );
+      TEST_ASSERT( h.get_snapshot().percentile( 50 ) == std::chrono::nanoseconds( 0 ) );
+
+      for( int i = 1; i <= 1000; ++i ) {
+         h.record( std::chrono::microseconds( i ) );
+      }
+      h.record( std::chrono::nanoseconds( -5 ) );
+
+      const auto s = h.get_snapshot();
+      TEST_ASSERT( s.count() == 1001 );
+      TEST_ASSERT( s.max() == std::chrono::microseconds( 1000 ) );
+      TEST_ASSERT( s.sum() == std::chrono::microseconds( 500500 ) );
+      TEST_ASSERT( s.mean() == std::chrono::nanoseconds( 500000 ) );
+      TEST_ASSERT( s.percentile( 0 ) == std::chrono::nanoseconds( 0 ) );
+      TEST_ASSERT( s.percentile( 100 ) == std::chrono::microseconds( 1000 ) );
+
+      const auto p50 = s.percentile( 50 );
+      TEST_ASSERT( p50 >= std::chrono::microseconds( 500 ) );
+      TEST_ASSERT( p50 <= std::chrono::microseconds( 500 ) * 17 / 16 );
+
+      const auto p99 = s.percentile( 99 );
+      TEST_ASSERT( p99 >= std::chrono::microseconds( 990 ) );
+      TEST_ASSERT( p99 <= std::chrono::microseconds( 1000 ) );
+
+      std::uint64_t total = 0;
+      for( const auto& [ bound, count ] : s.buckets() ) {
+         TEST_ASSERT( count != 0 );
+         total += count;
+      }
+      TEST_ASSERT( total == 1001 );
+
+      h.reset();
+      TEST_ASSERT( h.get_snapshot().count() == 0 );
+      TEST_ASSERT( h.get_snapshot().max() == std::chrono::nanoseconds( 0 ) );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <tao/pq/internal/mapped_file.hpp>
+
+namespace
+{
+   void run()
+   {
+      const auto path = std::filesystem::temp_directory_path() / "tao_mapped_file_test.txt";
+      {
+         std::ofstream( path, std::ios::binary ) << "";
+         const tao::pq::internal::mapped_file file( path );
+         TEST_ASSERT( file.size() == 0 );
+         TEST_ASSERT( file.view().empty() );
+      }
+      {
+         std::string data;
+         for( int n = 0; n < 10000; ++n ) {
+            data += std::to_string( n ) + '\n';
+         }
+         std::ofstream( path, std::ios::binary ) << data;
+         const tao::pq::internal::mapped_file file( path );
+         TEST_ASSERT( file.size() == data.size() );
+         TEST_ASSERT( file.view() == data );
+      }
+      std::filesystem::remove( path );
+      TEST_THROWS( tao::pq::internal::mapped_file( path ) );
+      TEST_THROWS( tao::pq::internal::mapped_file( std::filesystem::temp_directory_path() ) );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <tao/pq.hpp>
+#include <tao/pq/internal/endian.hpp>
+
+static_assert( tao::pq::result_type_binary< tao::pq::md_array< double > > );
+static_assert( tao::pq::result_type_binary< tao::pq::md_array< std::optional< int > > > );
+static_assert( tao::pq::result_type_binary< tao::pq::md_array< std::string > > );
+static_assert( tao::pq::result_type_binary< tao::pq::md_array< bool > > );
+static_assert( !tao::pq::result_type_binary< tao::pq::md_array< const char* > > );
+
+namespace
+{
+   template< typename T >
+   [[nodiscard]] auto from( const char* value ) -> tao::pq::md_array< T >
+   {
+      return tao::pq::result_traits< tao::pq::md_array< T > >::from( value );
+   }
+
+   template< typename T >
+   [[nodiscard]] auto from_binary( const std::string& data ) -> tao::pq::md_array< T >
+   {
+      return tao::pq::result_traits< tao::pq::md_array< T > >::from_binary( data.data(), data.size() );
+   }
+
+   void run()
+   {
+      // layout
+      {
+         const tao::pq::md_array< int > a( { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23 }, { 2, 3, 4 } );
+         TEST_ASSERT( a.rank() == 3 );
+         TEST_ASSERT( a.size() == 24 );
+         TEST_ASSERT( a.extent( 0 ) == 2 );
+         TEST_ASSERT( a.extent( 1 ) == 3 );
+         TEST_ASSERT( a.extent( 2 ) == 4 );
+         TEST_ASSERT( a.stride( 0 ) == 12 );
+         TEST_ASSERT( a.stride( 1 ) == 4 );
+         TEST_ASSERT( a.stride( 2 ) == 1 );
+         TEST_ASSERT( a( 0, 0, 0 ) == 0 );
+         TEST_ASSERT( a( 1, 2, 3 ) == 23 );
+         TEST_ASSERT( a( 1, 0, 2 ) == 14 );
+         TEST_ASSERT( a.at( 0, 1, 2 ) == 6 );
+         TEST_THROWS( a.at( 2, 0, 0 ) );
+         TEST_THROWS( a.at( 0, 0 ) );
+
+         const tao::pq::md_array< int > empty_array;
+         TEST_ASSERT( empty_array.rank() == 0 );
+         TEST_ASSERT( empty_array.empty() );
+
+         TEST_THROWS( tao::pq::md_array< int >( { 1, 2, 3 }, { 2, 2 } ) );
+         TEST_THROWS( tao::pq::md_array< int >( {}, { 1, 1, 1, 1, 1, 1, 1 } ) );
+      }
+
+      // text format
+      {
+         const auto a = from< double >( "{{1.5,2.5,3.5},{4.5,5.5,6.5}}" );
+         TEST_ASSERT( a == tao::pq::md_array< double >( { 1.5, 2.5, 3.5, 4.5, 5.5, 6.5 }, { 2, 3 } ) );
+         TEST_ASSERT( a( 1, 0 ) == 4.5 );
+
+         TEST_ASSERT( from< int >( "{}" ).empty() );
+         TEST_ASSERT( from< int >( "[0:1]={7,8}" ) == tao::pq::md_array< int >( { 7, 8 }, { 2 } ) );
+
+         const auto s = from< std::optional< std::string > >( "{{\"a,b\",NULL},{c,\"NULL\"}}" );
+         TEST_ASSERT( s.extent( 0 ) == 2 );
+         TEST_ASSERT( s( 0, 0 ) == "a,b" );
+         TEST_ASSERT( !s( 0, 1 ) );
+         TEST_ASSERT( s( 1, 1 ) == "NULL" );
+
+         const auto t = from< bool >( "{{t,f},{f,t}}" );
+         TEST_ASSERT( t == tao::pq::md_array< bool >( { true, false, false, true }, { 2, 2 } ) );
+         TEST_ASSERT( t( 1, 1 ) );
+         TEST_ASSERT( !t.at( 0, 1 ) );
+
+         TEST_THROWS( from< int >( "{{1,2},{3}}" ) );
+         TEST_THROWS( from< int >( "{1,NULL}" ) );
+         TEST_THROWS( from< int >( "{1,2}x" ) );
+         TEST_THROWS( from< int >( "1" ) );
+      }
+
+      // binary format
+      {
+         std::string data;
+         tao::pq::internal::append_big_endian( data, std::int32_t( 2 ) );
+         tao::pq::internal::append_big_endian( data, std::int32_t( 0 ) );
+         tao::pq::internal::append_big_endian( data, static_cast< std::uint32_t >( tao::pq::oid::float8 ) );
+         tao::pq::internal::append_big_endian( data, std::int32_t( 3 ) );
+         tao::pq::internal::append_big_endian( data, std::int32_t( 1 ) );
+         tao::pq::internal::append_big_endian( data, std::int32_t( 2 ) );
+         tao::pq::internal::append_big_endian( data, std::int32_t( 1 ) );
+         for( int i = 0; i < 6; ++i ) {
+            tao::pq::internal::append_big_endian( data, std::int32_t( 8 ) );
+            tao::pq::internal::append_big_endian( data, i * 0.5 );
+         }
+
+         const auto a = from_binary< double >( data );
+         TEST_ASSERT( a == tao::pq::md_array< double >( { 0.0, 0.5, 1.0, 1.5, 2.0, 2.5 }, { 3, 2 } ) );
+         TEST_ASSERT( a( 2, 1 ) == 2.5 );
+
+         const auto b = from_binary< std::optional< double > >( data );
+         TEST_ASSERT( b.size() == 6 );
+         TEST_ASSERT( b( 1, 1 ) == 1.5 );
+
+         std::string flags;
+         tao::pq::internal::append_big_endian( flags, std::int32_t( 1 ) );
+         tao::pq::internal::append_big_endian( flags, std::int32_t( 0 ) );
+         tao::pq::internal::append_big_endian( flags, static_cast< std::uint32_t >( tao::pq::oid::boolean ) );
+         tao::pq::internal::append_big_endian( flags, std::int32_t( 3 ) );
+         tao::pq::internal::append_big_endian( flags, std::int32_t( 1 ) );
+         for( const char c : { 1, 0, 1 } ) {
+            tao::pq::internal::append_big_endian( flags, std::int32_t( 1 ) );
+            flags += c;
+         }
+         const auto f = from_binary< bool >( flags );
+         TEST_ASSERT( f == tao::pq::md_array< bool >( { true, false, true }, { 3 } ) );
+         TEST_ASSERT( !f( 1 ) );
+
+         TEST_THROWS( from_binary< float >( data.substr( 0, data.size() - 1 ) ) );
+         TEST_THROWS( from_binary< double >( data + '\0' ) );
+
+         // the product of the extents would overflow to zero
+         std::string overflow;
+         tao::pq::internal::append_big_endian( overflow, std::int32_t( 4 ) );
+         tao::pq::internal::append_big_endian( overflow, std::int32_t( 0 ) );
+         tao::pq::internal::append_big_endian( overflow, static_cast< std::uint32_t >( tao::pq::oid::int4 ) );
+         for( int i = 0; i < 4; ++i ) {
+            tao::pq::internal::append_big_endian( overflow, std::int32_t( 65536 ) );
+            tao::pq::internal::append_big_endian( overflow, std::int32_t( 1 ) );
+         }
+         TEST_THROWS( from_binary< int >( overflow ) );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,229 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <list>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <tao/pq.hpp>
+#include <tao/pq/internal/endian.hpp>
+
+static_assert( tao::pq::parameter_type_binary< int > );
+static_assert( tao::pq::parameter_type_binary< double > );
+static_assert( tao::pq::parameter_type_binary< std::string > );
+static_assert( tao::pq::parameter_type_binary< const char* > );
+static_assert( tao::pq::parameter_type_binary< tao::pq::binary > );
+static_assert( tao::pq::parameter_type_binary< decltype( tao::pq::null ) > );
+static_assert( tao::pq::parameter_type_binary< std::optional< long long > > );
+static_assert( tao::pq::parameter_type_binary< std::tuple< bool, short, float > > );
+static_assert( tao::pq::parameter_type_binary< std::pair< std::string, std::optional< int > > > );
+static_assert( tao::pq::parameter_type_binary< std::vector< int > > );
+static_assert( !tao::pq::parameter_type_binary< unsigned > );
+static_assert( !tao::pq::parameter_type_binary< long double > );
+static_assert( !tao::pq::parameter_type_binary< std::vector< unsigned > > );
+static_assert( !tao::pq::parameter_type_binary< std::tuple< int, unsigned > > );
+static_assert( !tao::pq::parameter_type_binary< std::pair< unsigned, int > > );
+
+namespace
+{
+   template< typename T >
+   [[nodiscard]] auto to_binary( const T& v ) -> std::string
+   {
+      const tao::pq::parameter_traits< T > traits( v );
+      TEST_ASSERT( traits.template format< 0 >() == 1 );
+      return std::string( traits.template value< 0 >(), traits.template length< 0 >() );
+   }
+
+   template< typename R, typename T >
+   [[nodiscard]] auto round_trip( const T& v ) -> R
+   {
+      const auto data = to_binary( v );
+      return tao::pq::result_traits< R >::from_binary( data.data(), data.size() );
+   }
+
+   [[nodiscard]] auto get( const std::string& data, const std::size_t offset ) -> std::int32_t
+   {
+      return tao::pq::internal::from_big_endian< std::int32_t >( data.data() + offset );
+   }
+
+   template< typename T >
+   [[nodiscard]] auto copy_to_binary( const T& v ) -> std::string
+   {
+      const tao::pq::parameter_traits< T > traits( v );
+      std::string data;
+      [ & ]< std::size_t... Is >( std::index_sequence< Is... > /*unused*/ ) {
+         ( traits.template copy_to_binary< Is >( data ), ... );
+      }( std::make_index_sequence< tao::pq::parameter_traits< T >::columns >() );
+      return data;
+   }
+
+   template< typename T >
+   [[nodiscard]] auto field( const T v ) -> std::string
+   {
+      std::string data;
+      tao::pq::internal::append_big_endian( data, static_cast< std::int32_t >( sizeof( T ) ) );
+      tao::pq::internal::append_big_endian( data, v );
+      return data;
+   }
+
+   [[nodiscard]] auto field( const std::string_view v ) -> std::string
+   {
+      std::string data;
+      tao::pq::internal::append_big_endian( data, static_cast< std::int32_t >( v.size() ) );
+      return data.append( v );
+   }
+
+   [[nodiscard]] auto null_field() -> std::string
+   {
+      return std::string( 4, '\xff' );
+   }
+
+   void run()
+   {
+      // types
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< int > >::type< 0 >() == tao::pq::oid::int4_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< long long > >::type< 0 >() == tao::pq::oid::int8_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< short > >::type< 0 >() == tao::pq::oid::int2_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< bool > >::type< 0 >() == tao::pq::oid::boolean_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< float > >::type< 0 >() == tao::pq::oid::float4_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::set< double > >::type< 0 >() == tao::pq::oid::float8_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< std::optional< std::string > > >::type< 0 >() == tao::pq::oid::invalid );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< std::string > >::format< 0 >() == 0 );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< std::vector< int > > >::type< 0 >() == tao::pq::oid::int4_array );
+      TEST_ASSERT( tao::pq::parameter_traits< std::vector< tao::pq::binary > >::type< 0 >() == tao::pq::oid::bytea_array );
+
+      // header
+      {
+         const auto data = to_binary( std::vector< long long >{ 1, 2, 3 } );
+         TEST_ASSERT( data.size() == 20 + 3 * 12 );
+         TEST_ASSERT( get( data, 0 ) == 1 );
+         TEST_ASSERT( get( data, 4 ) == 0 );
+         TEST_ASSERT( get( data, 8 ) == static_cast< std::int32_t >( tao::pq::oid::int8 ) );
+         TEST_ASSERT( get( data, 12 ) == 3 );
+         TEST_ASSERT( get( data, 16 ) == 1 );
+         TEST_ASSERT( get( data, 20 ) == 8 );
+      }
+
+      // empty
+      {
+         const auto data = to_binary( std::vector< int >() );
+         TEST_ASSERT( data.size() == 12 );
+         TEST_ASSERT( get( data, 0 ) == 0 );
+         TEST_ASSERT( to_binary( std::vector< std::vector< int > >{ {}, {} } ).size() == 12 );
+      }
+
+      // round trips
+      {
+         std::vector< long long > v;
+         for( long long i = 0; i < 100000; ++i ) {
+            v.push_back( i * 1701 - 42 );
+         }
+         TEST_ASSERT( round_trip< std::vector< long long > >( v ) == v );
+         TEST_ASSERT( round_trip< std::vector< long long > >( std::span< const long long >( v ) ) == v );
+
+         const std::array a{ 1, 0, -2 };
+         TEST_ASSERT( round_trip< std::vector< int > >( a ) == std::vector< int >{ 1, 0, -2 } );
+
+         const std::vector< bool > b{ true, false, true };
+         TEST_ASSERT( round_trip< std::vector< bool > >( b ) == b );
+
+         const std::list< double > d{ 1.5, -0.25 };
+         TEST_ASSERT( round_trip< std::list< double > >( d ) == d );
+
+         const std::vector< std::vector< float > > f{ { 1, 2, 3 }, { 4, 5, 6 } };
+         TEST_ASSERT( round_trip< std::vector< std::vector< float > > >( f ) == f );
+
+         // arrays of strings are bound in text format, but binary COPY uses the binary format
+         const std::vector< std::string > s{ "FOO", "", "{B,A\"R}", "NULL" };
+         const auto payload = copy_to_binary( s ).substr( 4 );
+         TEST_ASSERT( get( payload, 8 ) == static_cast< std::int32_t >( tao::pq::oid::text ) );
+         TEST_ASSERT( tao::pq::result_traits< std::vector< std::string > >::from_binary( payload.data(), payload.size() ) == s );
+
+         const std::vector< std::optional< int > > o{ 1, std::nullopt, 3 };
+         const auto data = to_binary( o );
+         TEST_ASSERT( get( data, 4 ) == 1 );
+         TEST_ASSERT( round_trip< std::vector< std::optional< int > > >( o ) == o );
+
+         const std::vector< tao::pq::binary > y{ tao::pq::to_binary( "F\0O", 3 ), tao::pq::binary() };
+         TEST_ASSERT( round_trip< std::vector< tao::pq::binary > >( y ) == y );
+      }
+
+      // text representation
+      {
+         const std::vector< std::string > v{ "a b", "c" };
+         const tao::pq::parameter_traits< std::vector< std::string > > traits( v );
+         TEST_ASSERT( std::string_view( traits.value< 0 >() ) == "{\"a b\",c}" );
+         std::string data;
+         traits.copy_to< 0 >( data );
+         TEST_ASSERT( data == "{\"a b\",c}" );
+
+         const std::vector< int > i{ 1, 2 };
+         const tao::pq::parameter_traits< std::vector< int > > int_traits( i );
+         data.clear();
+         int_traits.copy_to< 0 >( data );
+         TEST_ASSERT( data == "{1,2}" );
+      }
+
+      // binary COPY
+      {
+         TEST_ASSERT( copy_to_binary( 42 ) == field( std::int32_t( 42 ) ) );
+         TEST_ASSERT( copy_to_binary( short( -2 ) ) == field( std::int16_t( -2 ) ) );
+         TEST_ASSERT( copy_to_binary( 1701LL ) == field( std::int64_t( 1701 ) ) );
+         TEST_ASSERT( copy_to_binary( 1.5 ) == field( 1.5 ) );
+         TEST_ASSERT( copy_to_binary( 0.25F ) == field( 0.25F ) );
+         TEST_ASSERT( copy_to_binary( true ) == field( std::string_view( "\1", 1 ) ) );
+         TEST_ASSERT( copy_to_binary( false ) == field( std::string_view( "\0", 1 ) ) );
+         TEST_ASSERT( copy_to_binary( 'x' ) == field( std::string_view( "x" ) ) );
+         TEST_ASSERT( copy_to_binary( static_cast< const char* >( "FOO" ) ) == field( std::string_view( "FOO" ) ) );
+         TEST_ASSERT( copy_to_binary( std::string( "B\tAR\n" ) ) == field( std::string_view( "B\tAR\n" ) ) );
+         TEST_ASSERT( copy_to_binary( tao::pq::to_binary( "\0\1", 2 ) ) == field( std::string_view( "\0\1", 2 ) ) );
+         TEST_ASSERT( copy_to_binary( tao::pq::null ) == null_field() );
+         TEST_ASSERT( copy_to_binary( std::optional< int >() ) == null_field() );
+         TEST_ASSERT( copy_to_binary( std::optional< int >( 7 ) ) == field( std::int32_t( 7 ) ) );
+         TEST_ASSERT( copy_to_binary( std::make_tuple( 1, std::string( "A" ), std::optional< double >() ) ) == field( std::int32_t( 1 ) ) + field( std::string_view( "A" ) ) + null_field() );
+         TEST_ASSERT( copy_to_binary( std::vector< int >{ 1, 2 } ) == field( std::string_view( to_binary( std::vector< int >{ 1, 2 } ) ) ) );
+
+         // text representation is generated on demand
+         const tao::pq::parameter_traits< double > traits( 0.5 );
+         TEST_ASSERT( std::string_view( traits.value< 0 >() ) == "0.5" );
+         std::string data;
+         traits.copy_to< 0 >( data );
+         TEST_ASSERT( data == "0.5" );
+      }
+
+      // jagged
+      TEST_THROWS( to_binary( std::vector< std::vector< int > >{ { 1, 2 }, { 3 } } ) );
+      TEST_THROWS( to_binary( std::vector< std::vector< int > >{ {}, { 3 } } ) );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -83,6 +83,26 @@ static_assert( tao::pq::parameter_type< std::vector< unsigned long long > > );
 static_assert( tao::pq::parameter_type< std::vector< std::set< double > > > );
 static_assert( tao::pq::parameter_type< std::set< std::vector< double > > > );
 
+// arrays of fixed-width types and bytea are bound in binary format
+static_assert( tao::pq::internal::binary_array_parameter_type< std::vector< long long > > );
+static_assert( tao::pq::internal::binary_array_parameter_type< std::span< const int > > );
+static_assert( tao::pq::internal::binary_array_parameter_type< std::array< double, 42 > > );
+static_assert( tao::pq::internal::binary_array_parameter_type< std::vector< std::set< double > > > );
+static_assert( tao::pq::internal::binary_array_parameter_type< std::vector< tao::pq::binary > > );
+static_assert( !tao::pq::internal::binary_array_parameter_type< std::vector< std::optional< std::string > > > );
+static_assert( !tao::pq::internal::binary_array_parameter_type< std::list< std::string_view > > );
+static_assert( !tao::pq::internal::binary_array_parameter_type< std::vector< unsigned long long > > );
+static_assert( !tao::pq::internal::binary_array_parameter_type< std::unordered_set< char > > );
+static_assert( !tao::pq::internal::binary_array_parameter_type< std::set< std::tuple< int > > > );
+static_assert( !tao::pq::internal::binary_array_parameter_type< std::list< const char* > > );
+
+// arrays of strings are bound untyped in text format, but written in binary format by binary COPY
+static_assert( tao::pq::internal::binary_copy_array_parameter_type< std::vector< long long > > );
+static_assert( tao::pq::internal::binary_copy_array_parameter_type< std::vector< std::optional< std::string > > > );
+static_assert( tao::pq::internal::binary_copy_array_parameter_type< std::list< std::string_view > > );
+static_assert( !tao::pq::internal::binary_copy_array_parameter_type< std::vector< unsigned long long > > );
+static_assert( !tao::pq::internal::binary_copy_array_parameter_type< std::list< const char* > > );
+
 // aggregate
 namespace example
 {
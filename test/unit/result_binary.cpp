@@ -0,0 +1,212 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <list>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tao/pq.hpp>
+#include <tao/pq/internal/endian.hpp>
+
+namespace
+{
+   template< typename T >
+   void append( std::string& data, const T v )
+   {
+      tao::pq::internal::append_big_endian( data, v );
+   }
+
+   [[nodiscard]] auto header( const tao::pq::oid element, const bool has_null, const std::vector< std::int32_t >& dimensions ) -> std::string
+   {
+      std::string data;
+      append( data, static_cast< std::int32_t >( dimensions.size() ) );
+      append( data, static_cast< std::int32_t >( has_null ? 1 : 0 ) );
+      append( data, static_cast< std::uint32_t >( element ) );
+      for( const auto d : dimensions ) {
+         append( data, d );
+         append( data, std::int32_t( 1 ) );
+      }
+      return data;
+   }
+
+   template< typename T >
+   void append_element( std::string& data, const T v )
+   {
+      append( data, static_cast< std::int32_t >( sizeof( T ) ) );
+      append( data, v );
+   }
+
+   void append_text( std::string& data, const std::string_view v )
+   {
+      append( data, static_cast< std::int32_t >( v.size() ) );
+      data += v;
+   }
+
+   void append_null( std::string& data )
+   {
+      append( data, std::int32_t( -1 ) );
+   }
+
+   template< typename T >
+   [[nodiscard]] auto from_binary( const std::string& data ) -> T
+   {
+      return tao::pq::result_traits< T >::from_binary( data.data(), data.size() );
+   }
+
+   void run()
+   {
+      // scalars
+      {
+         std::string data;
+         append( data, std::int32_t( -42 ) );
+         TEST_ASSERT( from_binary< int >( data ) == -42 );
+         TEST_ASSERT( from_binary< long long >( data ) == -42 );
+         TEST_ASSERT( from_binary< short >( data ) == -42 );
+         TEST_THROWS( from_binary< unsigned >( data ) );
+
+         data.clear();
+         append( data, std::int64_t( 1 ) << 40 );
+         TEST_ASSERT( from_binary< long long >( data ) == ( 1LL << 40 ) );
+         TEST_THROWS( from_binary< int >( data ) );
+
+         data.clear();
+         append( data, 3.5 );
+         TEST_ASSERT( from_binary< double >( data ) == 3.5 );
+         TEST_ASSERT( from_binary< float >( data ) == 3.5F );
+
+         TEST_ASSERT( from_binary< bool >( std::string( 1, '\1' ) ) );
+         TEST_ASSERT( !from_binary< bool >( std::string( 1, '\0' ) ) );
+         TEST_THROWS( from_binary< bool >( std::string( 1, '\2' ) ) );
+
+         TEST_ASSERT( from_binary< std::string >( std::string( "a\0b", 3 ) ) == std::string( "a\0b", 3 ) );
+         TEST_ASSERT( from_binary< tao::pq::binary >( std::string( "\0\1", 2 ) ) == tao::pq::to_binary( std::string( "\0\1", 2 ) ) );
+         TEST_ASSERT( from_binary< std::optional< int > >( std::string( "\0\0\0\7", 4 ) ) == 7 );
+
+         TEST_THROWS( from_binary< int >( std::string( 3, '\0' ) ) );
+      }
+
+      // accepted column types
+      {
+         static_assert( tao::pq::result_traits< int >::accepts_binary( tao::pq::oid::int8 ) );
+         static_assert( !tao::pq::result_traits< int >::accepts_binary( tao::pq::oid::float4 ) );
+         static_assert( !tao::pq::result_traits< int >::accepts_binary( tao::pq::oid::text ) );
+         static_assert( !tao::pq::result_traits< double >::accepts_binary( tao::pq::oid::int8 ) );
+         static_assert( tao::pq::result_traits< std::optional< float > >::accepts_binary( tao::pq::oid::float8 ) );
+         static_assert( !tao::pq::result_traits< bool >::accepts_binary( tao::pq::oid::int2 ) );
+         static_assert( tao::pq::result_traits< std::string >::accepts_binary( tao::pq::oid::varchar ) );
+         static_assert( tao::pq::result_traits< std::string >::accepts_binary( tao::pq::oid::first_user_defined ) );
+         static_assert( !tao::pq::result_traits< std::string >::accepts_binary( tao::pq::oid::int4 ) );
+         static_assert( !tao::pq::result_traits< std::string >::accepts_binary( tao::pq::oid::bytea ) );
+         static_assert( tao::pq::result_traits< tao::pq::binary >::accepts_binary( tao::pq::oid::bytea ) );
+         static_assert( !tao::pq::result_traits< tao::pq::binary >::accepts_binary( tao::pq::oid::text ) );
+
+         auto data = header( tao::pq::oid::float4, false, { 2 } );
+         append_element( data, 1.5F );
+         append_element( data, 2.5F );
+         TEST_ASSERT( from_binary< std::vector< double > >( data ) == std::vector< double >{ 1.5, 2.5 } );
+         TEST_THROWS( from_binary< std::vector< int > >( data ) );
+         TEST_THROWS( from_binary< std::vector< std::string > >( data ) );
+      }
+
+      // empty array
+      {
+         const auto data = header( tao::pq::oid::int4, false, {} );
+         TEST_ASSERT( from_binary< std::vector< int > >( data ).empty() );
+         TEST_ASSERT( from_binary< std::vector< std::vector< int > > >( data ).empty() );
+      }
+
+      // fixed-width fast path
+      {
+         auto data = header( tao::pq::oid::int4, false, { 4 } );
+         append_element( data, std::int32_t( 1 ) );
+         append_element( data, std::int32_t( 0 ) );
+         append_element( data, std::int32_t( -2 ) );
+         append_element( data, std::int32_t( 1701 ) );
+         TEST_ASSERT( from_binary< std::vector< int > >( data ) == std::vector< int >{ 1, 0, -2, 1701 } );
+         TEST_ASSERT( from_binary< std::vector< long long > >( data ) == std::vector< long long >{ 1, 0, -2, 1701 } );
+         TEST_ASSERT( from_binary< std::list< int > >( data ) == std::list< int >{ 1, 0, -2, 1701 } );
+         TEST_ASSERT( from_binary< std::set< int > >( data ) == std::set< int >{ -2, 0, 1, 1701 } );
+         TEST_THROWS( from_binary< std::vector< unsigned > >( data ) );
+         TEST_THROWS( from_binary< std::vector< std::vector< int > > >( data ) );
+
+         data += '\0';
+         TEST_THROWS( from_binary< std::vector< int > >( data ) );
+         data.resize( data.size() - 2 );
+         TEST_THROWS( from_binary< std::vector< int > >( data ) );
+      }
+
+      // NULL elements
+      {
+         auto data = header( tao::pq::oid::int8, true, { 3 } );
+         append_element( data, std::int64_t( 42 ) );
+         append_null( data );
+         append_element( data, std::int64_t( -1 ) );
+         const auto v = from_binary< std::vector< std::optional< long long > > >( data );
+         TEST_ASSERT( v.size() == 3 );
+         TEST_ASSERT( v[ 0 ] == 42 );
+         TEST_ASSERT( !v[ 1 ] );
+         TEST_ASSERT( v[ 2 ] == -1 );
+         TEST_THROWS( from_binary< std::vector< long long > >( data ) );
+      }
+
+      // multiple dimensions
+      {
+         auto data = header( tao::pq::oid::float8, false, { 2, 3 } );
+         for( int i = 0; i < 6; ++i ) {
+            append_element( data, i * 0.5 );
+         }
+         const auto v = from_binary< std::vector< std::vector< double > > >( data );
+         TEST_ASSERT( v.size() == 2 );
+         TEST_ASSERT( v[ 0 ] == std::vector< double >{ 0.0, 0.5, 1.0 } );
+         TEST_ASSERT( v[ 1 ] == std::vector< double >{ 1.5, 2.0, 2.5 } );
+         TEST_THROWS( from_binary< std::vector< double > >( data ) );
+      }
+
+      // variable-width elements
+      {
+         auto data = header( tao::pq::oid::text, true, { 3 } );
+         append_text( data, "FOO" );
+         append_text( data, "" );
+         append_null( data );
+         const auto v = from_binary< std::vector< std::optional< std::string > > >( data );
+         TEST_ASSERT( v.size() == 3 );
+         TEST_ASSERT( v[ 0 ] == "FOO" );
+         TEST_ASSERT( v[ 1 ] == "" );
+         TEST_ASSERT( !v[ 2 ] );
+      }
+
+      // invalid headers
+      {
+         TEST_THROWS( from_binary< std::vector< int > >( std::string( 11, '\0' ) ) );
+         TEST_THROWS( from_binary< std::vector< int > >( header( tao::pq::oid::int4, false, { -1 } ) ) );
+         TEST_THROWS( from_binary< std::vector< int > >( header( tao::pq::oid::int4, false, { 1, 1, 1, 1, 1, 1, 1 } ) ) );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
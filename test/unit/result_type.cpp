@@ -81,6 +81,18 @@ static_assert( tao::pq::result_type< std::vector< unsigned long long > > );
 static_assert( tao::pq::result_type< std::vector< std::set< double > > > );
 static_assert( tao::pq::result_type< std::set< std::vector< double > > > );
 
+// binary format
+static_assert( tao::pq::result_type_binary< int > );
+static_assert( tao::pq::result_type_binary< double > );
+static_assert( tao::pq::result_type_binary< std::string > );
+static_assert( tao::pq::result_type_binary< tao::pq::binary > );
+static_assert( !tao::pq::result_type_binary< const char* > );
+static_assert( tao::pq::result_type_binary< std::optional< int > > );
+static_assert( tao::pq::result_type_binary< std::vector< int > > );
+static_assert( tao::pq::result_type_binary< std::vector< std::vector< double > > > );
+static_assert( tao::pq::result_type_binary< std::vector< std::optional< std::string > > > );
+static_assert( !tao::pq::result_type_binary< std::vector< const char* > > );
+
 // aggregate
 namespace example
 {
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tao/pq/internal/ring_buffer.hpp>
+
+namespace
+{
+   void run()
+   {
+      {
+         tao::pq::internal::ring_buffer< std::string > rb( 3 );
+         TEST_ASSERT( rb.capacity() == 4 );
+
+         std::string s;
+         TEST_ASSERT( !rb.try_pop( s ) );
+
+         TEST_ASSERT( rb.try_push( "a" ) );
+         TEST_ASSERT( rb.try_push( "b" ) );
+         TEST_ASSERT( rb.try_push( "c" ) );
+         TEST_ASSERT( rb.try_push( "d" ) );
+         TEST_ASSERT( !rb.try_push( "e" ) );
+
+         TEST_ASSERT( rb.try_pop( s ) );
+         TEST_ASSERT( s == "a" );
+         TEST_ASSERT( rb.try_push( "f" ) );
+         TEST_ASSERT( !rb.try_push( "g" ) );
+
+         for( const auto* expected : { "b", "c", "d", "f" } ) {
+            TEST_ASSERT( rb.try_pop( s ) );
+            TEST_ASSERT( s == expected );
+         }
+         TEST_ASSERT( !rb.try_pop( s ) );
+      }
+      {
+         constexpr std::size_t producers = 4;
+         constexpr std::size_t per_producer = 10000;
+
+         tao::pq::internal::ring_buffer< std::size_t > rb( 64 );
+         std::atomic< std::size_t > done = 0;
+         std::vector< std::thread > threads;
+         for( std::size_t p = 0; p != producers; ++p ) {
+            threads.emplace_back( [ &, p ] {
+               for( std::size_t i = 0; i != per_producer; ++i ) {
+                  while( !rb.try_push( ( p * per_producer ) + i ) ) {
+                     std::this_thread::yield();
+                  }
+               }
+               ++done;
+            } );
+         }
+
+         // values of each producer arrive in order
+         std::vector< std::size_t > next( producers, 0 );
+         std::size_t received = 0;
+         while( received != producers * per_producer ) {
+            std::size_t v = 0;
+            if( rb.try_pop( v ) ) {
+               const auto p = v / per_producer;
+               TEST_ASSERT( v % per_producer == next[ p ] );
+               ++next[ p ];
+               ++received;
+            }
+         }
+         for( auto& t : threads ) {
+            t.join();
+         }
+         TEST_ASSERT( done == producers );
+         std::size_t v = 0;
+         TEST_ASSERT( !rb.try_pop( v ) );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,346 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <exception>
+#include <iostream>
+#include <string_view>
+#include <typeinfo>
+
+#include <tao/pq/exception.hpp>
+#include <tao/pq/try_result.hpp>
+
+namespace
+{
+   template< typename T >
+   void check( const std::string_view sql_state )
+   {
+      try {
+         tao::pq::internal::throw_sqlstate( "message", sql_state );
+      }
+      catch( const tao::pq::sql_error& e ) {
+         if( ( typeid( e ) != typeid( T ) ) || ( e.sqlstate != sql_state ) || ( std::string_view( e.what() ) != "message" ) ) {
+            std::cerr << "SQLSTATE [ " << sql_state << " ] threw [ " << tao::pq::internal::demangle( typeid( e ) ) << " ]\n";
+            TEST_FAILED;
+         }
+         return;
+      }
+      TEST_FAILED;  // LCOV_EXCL_LINE
+   }
+
+   void run()
+   {
+      // every specific code
+      check< tao::pq::null_value_eliminated_in_set_function >( "01003" );
+      check< tao::pq::string_data_right_truncation< tao::pq::warning > >( "01004" );
+      check< tao::pq::privilege_not_revoked >( "01006" );
+      check< tao::pq::privilege_not_granted >( "01007" );
+      check< tao::pq::implicit_zero_bit_padding >( "01008" );
+      check< tao::pq::dynamic_result_sets_returned >( "0100C" );
+      check< tao::pq::deprecated_feature >( "01P01" );
+      check< tao::pq::no_additional_dynamic_result_sets_returned >( "02001" );
+      check< tao::pq::sqlclient_unable_to_establish_sqlconnection >( "08001" );
+      check< tao::pq::connection_does_not_exist >( "08003" );
+      check< tao::pq::sqlserver_rejected_establishment_of_sqlconnection >( "08004" );
+      check< tao::pq::connection_failure >( "08006" );
+      check< tao::pq::transaction_resolution_unknown >( "08007" );
+      check< tao::pq::protocol_violation >( "08P01" );
+      check< tao::pq::invalid_locator_specification >( "0F001" );
+      check< tao::pq::invalid_grant_operation >( "0LP01" );
+      check< tao::pq::stacked_diagnostics_accessed_without_active_handler >( "0Z002" );
+      check< tao::pq::string_data_right_truncation< tao::pq::data_exception > >( "22001" );
+      check< tao::pq::null_value_no_indicator_parameter >( "22002" );
+      check< tao::pq::numeric_value_out_of_range >( "22003" );
+      check< tao::pq::null_value_not_allowed >( "22004" );
+      check< tao::pq::error_in_assignment >( "22005" );
+      check< tao::pq::invalid_datetime_format >( "22007" );
+      check< tao::pq::datetime_field_overflow >( "22008" );
+      check< tao::pq::invalid_time_zone_displacement_value >( "22009" );
+      check< tao::pq::escape_character_conflict >( "2200B" );
+      check< tao::pq::invalid_use_of_escape_character >( "2200C" );
+      check< tao::pq::invalid_escape_octet >( "2200D" );
+      check< tao::pq::zero_length_character_string >( "2200F" );
+      check< tao::pq::most_specific_type_mismatch >( "2200G" );
+      check< tao::pq::sequence_generator_limit_exceeded >( "2200H" );
+      check< tao::pq::not_an_xml_document >( "2200L" );
+      check< tao::pq::invalid_xml_document >( "2200M" );
+      check< tao::pq::invalid_xml_content >( "2200N" );
+      check< tao::pq::invalid_xml_comment >( "2200S" );
+      check< tao::pq::invalid_xml_processing_instruction >( "2200T" );
+      check< tao::pq::invalid_indicator_parameter_value >( "22010" );
+      check< tao::pq::substring_error >( "22011" );
+      check< tao::pq::division_by_zero >( "22012" );
+      check< tao::pq::invalid_preceding_or_following_size >( "22013" );
+      check< tao::pq::invalid_argument_for_ntile_function >( "22014" );
+      check< tao::pq::interval_field_overflow >( "22015" );
+      check< tao::pq::invalid_argument_for_nth_value_function >( "22016" );
+      check< tao::pq::invalid_character_value_for_cast >( "22018" );
+      check< tao::pq::invalid_escape_character >( "22019" );
+      check< tao::pq::invalid_regular_expression >( "2201B" );
+      check< tao::pq::invalid_argument_for_logarithm >( "2201E" );
+      check< tao::pq::invalid_argument_for_power_function >( "2201F" );
+      check< tao::pq::invalid_argument_for_width_bucket_function >( "2201G" );
+      check< tao::pq::invalid_row_count_in_limit_clause >( "2201W" );
+      check< tao::pq::invalid_row_count_in_result_offset_clause >( "2201X" );
+      check< tao::pq::character_not_in_repertoire >( "22021" );
+      check< tao::pq::indicator_overflow >( "22022" );
+      check< tao::pq::invalid_parameter_value >( "22023" );
+      check< tao::pq::unterminated_c_string >( "22024" );
+      check< tao::pq::invalid_escape_sequence >( "22025" );
+      check< tao::pq::string_data_length_mismatch >( "22026" );
+      check< tao::pq::trim_error >( "22027" );
+      check< tao::pq::array_subscript_error >( "2202E" );
+      check< tao::pq::invalid_tablesample_repeat >( "2202G" );
+      check< tao::pq::invalid_tablesample_argument >( "2202H" );
+      check< tao::pq::duplicate_json_object_key_value >( "22030" );
+      check< tao::pq::invalid_argument_for_sql_json_datetime_function >( "22031" );
+      check< tao::pq::invalid_json_text >( "22032" );
+      check< tao::pq::invalid_sql_json_subscript >( "22033" );
+      check< tao::pq::more_than_one_sql_json_item >( "22034" );
+      check< tao::pq::no_sql_json_item >( "22035" );
+      check< tao::pq::non_numeric_sql_json_item >( "22036" );
+      check< tao::pq::non_unique_keys_in_a_json_object >( "22037" );
+      check< tao::pq::singleton_sql_json_item_required >( "22038" );
+      check< tao::pq::sql_json_array_not_found >( "22039" );
+      check< tao::pq::sql_json_member_not_found >( "2203A" );
+      check< tao::pq::sql_json_number_not_found >( "2203B" );
+      check< tao::pq::sql_json_object_not_found >( "2203C" );
+      check< tao::pq::too_many_json_array_elements >( "2203D" );
+      check< tao::pq::too_many_json_object_members >( "2203E" );
+      check< tao::pq::sql_json_scalar_required >( "2203F" );
+      check< tao::pq::floating_point_exception >( "22P01" );
+      check< tao::pq::invalid_text_representation >( "22P02" );
+      check< tao::pq::invalid_binary_representation >( "22P03" );
+      check< tao::pq::bad_copy_file_format >( "22P04" );
+      check< tao::pq::untranslatable_character >( "22P05" );
+      check< tao::pq::nonstandard_use_of_escape_character >( "22P06" );
+      check< tao::pq::restrict_violation >( "23001" );
+      check< tao::pq::not_null_violation >( "23502" );
+      check< tao::pq::foreign_key_violation >( "23503" );
+      check< tao::pq::unique_violation >( "23505" );
+      check< tao::pq::check_violation >( "23514" );
+      check< tao::pq::exclusion_violation >( "23P01" );
+      check< tao::pq::active_sql_transaction >( "25001" );
+      check< tao::pq::branch_transaction_already_active >( "25002" );
+      check< tao::pq::inappropriate_access_mode_for_branch_transaction >( "25003" );
+      check< tao::pq::inappropriate_isolation_level_for_branch_transaction >( "25004" );
+      check< tao::pq::no_active_sql_transaction_for_branch_transaction >( "25005" );
+      check< tao::pq::read_only_sql_transaction >( "25006" );
+      check< tao::pq::schema_and_data_statement_mixing_not_supported >( "25007" );
+      check< tao::pq::held_cursor_requires_same_isolation_level >( "25008" );
+      check< tao::pq::no_active_sql_transaction >( "25P01" );
+      check< tao::pq::in_failed_sql_transaction >( "25P02" );
+      check< tao::pq::idle_in_transaction_session_timeout >( "25P03" );
+      check< tao::pq::invalid_password >( "28P01" );
+      check< tao::pq::dependent_objects_still_exist >( "2BP01" );
+      check< tao::pq::modifying_sql_data_not_permitted< tao::pq::sql_routine_exception > >( "2F002" );
+      check< tao::pq::prohibited_sql_statement_attempted< tao::pq::sql_routine_exception > >( "2F003" );
+      check< tao::pq::reading_sql_data_not_permitted< tao::pq::sql_routine_exception > >( "2F004" );
+      check< tao::pq::function_executed_no_return_statement >( "2F005" );
+      check< tao::pq::containing_sql_not_permitted >( "38001" );
+      check< tao::pq::modifying_sql_data_not_permitted< tao::pq::external_routine_exception > >( "38002" );
+      check< tao::pq::prohibited_sql_statement_attempted< tao::pq::external_routine_exception > >( "38003" );
+      check< tao::pq::reading_sql_data_not_permitted< tao::pq::external_routine_exception > >( "38004" );
+      check< tao::pq::invalid_sqlstate_returned >( "39001" );
+      check< tao::pq::external_null_value_not_allowed >( "39004" );
+      check< tao::pq::trigger_protocol_violated >( "39P01" );
+      check< tao::pq::srf_protocol_violated >( "39P02" );
+      check< tao::pq::event_trigger_protocol_violated >( "39P03" );
+      check< tao::pq::invalid_savepoint_specification >( "3B001" );
+      check< tao::pq::serialization_failure >( "40001" );
+      check< tao::pq::transaction_integrity_constraint_violation >( "40002" );
+      check< tao::pq::statement_completion_unknown >( "40003" );
+      check< tao::pq::deadlock_detected >( "40P01" );
+      check< tao::pq::insufficient_privilege >( "42501" );
+      check< tao::pq::syntax_error >( "42601" );
+      check< tao::pq::invalid_name >( "42602" );
+      check< tao::pq::invalid_column_definition >( "42611" );
+      check< tao::pq::name_too_long >( "42622" );
+      check< tao::pq::duplicate_column >( "42701" );
+      check< tao::pq::ambiguous_column >( "42702" );
+      check< tao::pq::undefined_column >( "42703" );
+      check< tao::pq::undefined_object >( "42704" );
+      check< tao::pq::duplicate_object >( "42710" );
+      check< tao::pq::duplicate_alias >( "42712" );
+      check< tao::pq::duplicate_function >( "42723" );
+      check< tao::pq::ambiguous_function >( "42725" );
+      check< tao::pq::grouping_error >( "42803" );
+      check< tao::pq::datatype_mismatch >( "42804" );
+      check< tao::pq::wrong_object_type >( "42809" );
+      check< tao::pq::invalid_foreign_key >( "42830" );
+      check< tao::pq::cannot_coerce >( "42846" );
+      check< tao::pq::undefined_function >( "42883" );
+      check< tao::pq::generated_always >( "428C9" );
+      check< tao::pq::reserved_name >( "42939" );
+      check< tao::pq::undefined_table >( "42P01" );
+      check< tao::pq::undefined_parameter >( "42P02" );
+      check< tao::pq::duplicate_cursor >( "42P03" );
+      check< tao::pq::duplicate_database >( "42P04" );
+      check< tao::pq::duplicate_prepared_statement >( "42P05" );
+      check< tao::pq::duplicate_schema >( "42P06" );
+      check< tao::pq::duplicate_table >( "42P07" );
+      check< tao::pq::ambiguous_parameter >( "42P08" );
+      check< tao::pq::ambiguous_alias >( "42P09" );
+      check< tao::pq::invalid_column_reference >( "42P10" );
+      check< tao::pq::invalid_cursor_definition >( "42P11" );
+      check< tao::pq::invalid_database_definition >( "42P12" );
+      check< tao::pq::invalid_function_definition >( "42P13" );
+      check< tao::pq::invalid_prepared_statement_definition >( "42P14" );
+      check< tao::pq::invalid_schema_definition >( "42P15" );
+      check< tao::pq::invalid_table_definition >( "42P16" );
+      check< tao::pq::invalid_object_definition >( "42P17" );
+      check< tao::pq::indeterminate_datatype >( "42P18" );
+      check< tao::pq::invalid_recursion >( "42P19" );
+      check< tao::pq::windowing_error >( "42P20" );
+      check< tao::pq::collation_mismatch >( "42P21" );
+      check< tao::pq::indeterminate_collation >( "42P22" );
+      check< tao::pq::disk_full >( "53100" );
+      check< tao::pq::out_of_memory >( "53200" );
+      check< tao::pq::too_many_connections >( "53300" );
+      check< tao::pq::configuration_limit_exceeded >( "53400" );
+      check< tao::pq::statement_too_complex >( "54001" );
+      check< tao::pq::too_many_columns >( "54011" );
+      check< tao::pq::too_many_arguments >( "54023" );
+      check< tao::pq::object_in_use >( "55006" );
+      check< tao::pq::cant_change_runtime_param >( "55P02" );
+      check< tao::pq::lock_not_available >( "55P03" );
+      check< tao::pq::unsafe_new_enum_value_usage >( "55P04" );
+      check< tao::pq::query_canceled >( "57014" );
+      check< tao::pq::admin_shutdown >( "57P01" );
+      check< tao::pq::crash_shutdown >( "57P02" );
+      check< tao::pq::cannot_connect_now >( "57P03" );
+      check< tao::pq::database_dropped >( "57P04" );
+      check< tao::pq::io_error >( "58030" );
+      check< tao::pq::undefined_file >( "58P01" );
+      check< tao::pq::duplicate_file >( "58P02" );
+      check< tao::pq::lock_file_exists >( "F0001" );
+      check< tao::pq::fdw_out_of_memory >( "HV001" );
+      check< tao::pq::fdw_dynamic_parameter_value_needed >( "HV002" );
+      check< tao::pq::fdw_invalid_data_type >( "HV004" );
+      check< tao::pq::fdw_column_name_not_found >( "HV005" );
+      check< tao::pq::fdw_invalid_data_type_descriptors >( "HV006" );
+      check< tao::pq::fdw_invalid_column_name >( "HV007" );
+      check< tao::pq::fdw_invalid_column_number >( "HV008" );
+      check< tao::pq::fdw_invalid_use_of_null_pointer >( "HV009" );
+      check< tao::pq::fdw_invalid_string_format >( "HV00A" );
+      check< tao::pq::fdw_invalid_handle >( "HV00B" );
+      check< tao::pq::fdw_invalid_option_index >( "HV00C" );
+      check< tao::pq::fdw_invalid_option_name >( "HV00D" );
+      check< tao::pq::fdw_option_name_not_found >( "HV00J" );
+      check< tao::pq::fdw_reply_handle >( "HV00K" );
+      check< tao::pq::fdw_unable_to_create_execution >( "HV00L" );
+      check< tao::pq::fdw_unable_to_create_reply >( "HV00M" );
+      check< tao::pq::fdw_unable_to_establish_connection >( "HV00N" );
+      check< tao::pq::fdw_no_schemas >( "HV00P" );
+      check< tao::pq::fdw_schema_not_found >( "HV00Q" );
+      check< tao::pq::fdw_table_not_found >( "HV00R" );
+      check< tao::pq::fdw_function_sequence_error >( "HV010" );
+      check< tao::pq::fdw_too_many_handles >( "HV014" );
+      check< tao::pq::fdw_inconsistent_descriptor_information >( "HV021" );
+      check< tao::pq::fdw_invalid_attribute_value >( "HV024" );
+      check< tao::pq::fdw_invalid_string_length_or_buffer_length >( "HV090" );
+      check< tao::pq::fdw_invalid_descriptor_field_identifier >( "HV091" );
+      check< tao::pq::raise_exception >( "P0001" );
+      check< tao::pq::no_data_found >( "P0002" );
+      check< tao::pq::too_many_rows >( "P0003" );
+      check< tao::pq::assert_failure >( "P0004" );
+      check< tao::pq::data_corrupted >( "XX001" );
+      check< tao::pq::index_corrupted >( "XX002" );
+
+      // codes that are not listed fall back to their class
+      check< tao::pq::success >( "00999" );
+      check< tao::pq::warning >( "01999" );
+      check< tao::pq::no_data >( "02999" );
+      check< tao::pq::sql_statement_not_yet_complete >( "03999" );
+      check< tao::pq::connection_error >( "08999" );
+      check< tao::pq::triggered_action_exception >( "09999" );
+      check< tao::pq::feature_not_supported >( "0A999" );
+      check< tao::pq::invalid_transaction_initiation >( "0B999" );
+      check< tao::pq::locator_exception >( "0F999" );
+      check< tao::pq::invalid_grantor >( "0L999" );
+      check< tao::pq::invalid_role_specification >( "0P999" );
+      check< tao::pq::diagnostics_exception >( "0Z999" );
+      check< tao::pq::case_not_found >( "20999" );
+      check< tao::pq::cardinality_violation >( "21999" );
+      check< tao::pq::data_exception >( "22999" );
+      check< tao::pq::integrity_constraint_violation >( "23999" );
+      check< tao::pq::invalid_cursor_state >( "24999" );
+      check< tao::pq::invalid_transaction_state >( "25999" );
+      check< tao::pq::invalid_sql_statement_name >( "26999" );
+      check< tao::pq::triggered_data_change_violation >( "27999" );
+      check< tao::pq::invalid_authorization_specification >( "28999" );
+      check< tao::pq::dependent_privilege_descriptors_still_exist >( "2B999" );
+      check< tao::pq::invalid_transaction_termination >( "2D999" );
+      check< tao::pq::sql_routine_exception >( "2F999" );
+      check< tao::pq::invalid_cursor_name >( "34999" );
+      check< tao::pq::external_routine_exception >( "38999" );
+      check< tao::pq::external_routine_invocation_exception >( "39999" );
+      check< tao::pq::savepoint_exception >( "3B999" );
+      check< tao::pq::invalid_catalog_name >( "3D999" );
+      check< tao::pq::invalid_schema_name >( "3F999" );
+      check< tao::pq::transaction_rollback >( "40999" );
+      check< tao::pq::syntax_error_or_access_rule_violation >( "42999" );
+      check< tao::pq::with_check_option_violation >( "44999" );
+      check< tao::pq::insufficient_resources >( "53999" );
+      check< tao::pq::program_limit_exceeded >( "54999" );
+      check< tao::pq::object_not_in_prerequisite_state >( "55999" );
+      check< tao::pq::operator_intervention >( "57999" );
+      check< tao::pq::system_error >( "58999" );
+      check< tao::pq::snapshot_too_old >( "72999" );
+      check< tao::pq::config_file_error >( "F0999" );
+      check< tao::pq::fdw_error >( "HV999" );
+      check< tao::pq::plpgsql_error >( "P0999" );
+      check< tao::pq::internal_error >( "XX999" );
+
+      // unknown classes
+      check< tao::pq::sql_error >( "0X000" );
+      check< tao::pq::sql_error >( "99999" );
+      check< tao::pq::sql_error >( "ZZ000" );
+
+      // malformed codes
+      check< tao::pq::sql_error >( "" );
+      check< tao::pq::sql_error >( "0" );
+      check< tao::pq::warning >( "01" );
+      check< tao::pq::warning >( "01003X" );
+      check< tao::pq::integrity_constraint_violation >( "2350" );
+
+      // the error of a try_result throws the same exception
+      const tao::pq::try_result r = tao::pq::sql_error_info{ "40001", "could not serialize access", "", "" };
+      TEST_ASSERT( !r );
+      TEST_ASSERT( r.error().sqlstate == "40001" );
+      TEST_THROWS( (void)r.value() );
+      try {
+         r.error().raise();
+      }
+      catch( const tao::pq::serialization_failure& e ) {
+         TEST_ASSERT( e.sqlstate == "40001" );
+         TEST_ASSERT( std::string_view( e.what() ) == "could not serialize access" );
+      }
+      try {
+         tao::pq::sql_error_info{ "40001", "could not serialize access", "", "ERROR:  could not serialize access\n" }.raise();
+      }
+      catch( const tao::pq::serialization_failure& e ) {
+         TEST_ASSERT( std::string_view( e.what() ) == "ERROR:  could not serialize access\n" );
+      }
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
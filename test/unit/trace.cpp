@@ -0,0 +1,88 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utils/macros.hpp"
+
+#include <exception>
+#include <iostream>
+#include <memory>
+
+#include <tao/pq/log.hpp>
+#include <tao/pq/trace.hpp>
+
+namespace
+{
+   using tao::pq::no_trace;
+   using tao::pq::runtime_trace;
+   using tao::pq::trace_point;
+
+   template< trace_point P, typename T >
+   [[nodiscard]] auto same( tao::pq::log& log, const T& hook ) -> bool
+   {
+      return static_cast< const void* >( &runtime_trace::hook< P >( log ) ) == static_cast< const void* >( &hook );
+   }
+
+   void run()
+   {
+      const auto log = std::make_shared< tao::pq::log >();
+
+      TEST_ASSERT( ( same< trace_point::connection_pool_acquire >( *log, log->connection_pool.acquire ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_pool_create >( *log, log->connection_pool.create ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_pool_release >( *log, log->connection_pool.release ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_pool_discard >( *log, log->connection_pool.discard ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_pool_counts >( *log, log->connection_pool.counts ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_send_query >( *log, log->connection.send_query ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_send_query_result >( *log, log->connection.send_query.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_send_query_prepared >( *log, log->connection.send_query_prepared ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_send_query_prepared_result >( *log, log->connection.send_query_prepared.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_wait >( *log, log->connection.wait ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_poll >( *log, log->connection.poll ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_poll_result >( *log, log->connection.poll.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_is_busy_result >( *log, log->connection.is_busy.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_consume_input >( *log, log->connection.consume_input ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_consume_input_result >( *log, log->connection.consume_input.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_flush >( *log, log->connection.flush ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_flush_result >( *log, log->connection.flush.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_get_result >( *log, log->connection.get_result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_get_result_result >( *log, log->connection.get_result.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_enter_pipeline_mode_result >( *log, log->connection.enter_pipeline_mode.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_exit_pipeline_mode >( *log, log->connection.exit_pipeline_mode ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_exit_pipeline_mode_result >( *log, log->connection.exit_pipeline_mode.result ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_pipeline_sync >( *log, log->connection.pipeline_sync ) ) );
+      TEST_ASSERT( ( same< trace_point::connection_pipeline_sync_result >( *log, log->connection.pipeline_sync.result ) ) );
+      TEST_ASSERT( ( same< trace_point::transaction_destructor_rollback_failed >( *log, log->transaction.destructor_rollback_failed ) ) );
+
+      TEST_ASSERT( !runtime_trace::active< trace_point::connection_flush >( nullptr ) );
+      TEST_ASSERT( !runtime_trace::active< trace_point::connection_flush >( log ) );
+      TEST_ASSERT( !runtime_trace::active< trace_point::connection_flush_result >( log ) );
+
+      log->connection.flush = []( tao::pq::connection& /*unused*/ ) {};
+      TEST_ASSERT( runtime_trace::active< trace_point::connection_flush >( log ) );
+      TEST_ASSERT( !runtime_trace::active< trace_point::connection_flush_result >( log ) );
+
+      log->connection.flush.result = []( tao::pq::connection& /*unused*/, int /*unused*/ ) {};
+      TEST_ASSERT( runtime_trace::active< trace_point::connection_flush_result >( log ) );
+
+      TEST_ASSERT( !no_trace::active< trace_point::connection_flush >( log ) );
+      no_trace::call< trace_point::connection_flush_result >( log, 42 );
+   }
+
+}  // namespace
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << '\n';
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception\n";
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,184 @@
+// Copyright (c) 2026 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SRC_TEST_BENCHMARK_HPP  // NOLINT(llvm-header-guard)
+#define SRC_TEST_BENCHMARK_HPP
+
+// This is an internal header used for benchmarks.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <latch>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "getenv.hpp"
+
+namespace tao::pq::internal::benchmark
+{
+   template< typename T >
+   inline void do_not_optimize( const T& value ) noexcept
+   {
+#if defined( __GNUC__ ) || defined( __clang__ )
+      asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+      static const volatile void* sink;
+      sink = &value;
+#endif
+   }
+
+   // runs each benchmark for a minimum time and prints one JSON object per line:
+   // {"name":...,"threads":...,"iterations":...,"ns_per_op":...,"ns_per_op_min":...,"ops_per_second":...}
+   // or for workloads:
+   // {"name":...,"threads":...,"operations":...,"items_per_second":...,"p50_us":...,"p99_us":...}
+   // the time per benchmark can be set in milliseconds with TAOPQ_BENCHMARK_TIME,
+   // the first command line argument filters the benchmarks by name.
+   class runner final
+   {
+   private:
+      static constexpr std::size_t samples = 5;
+      static constexpr std::size_t min_operations = 20;
+
+      using clock = std::chrono::steady_clock;
+
+      std::string m_filter;
+      std::chrono::nanoseconds m_sample_time;
+
+      template< typename F >
+      [[nodiscard]] static auto measure( const std::size_t threads, const std::size_t iterations, F& f ) -> std::chrono::nanoseconds
+      {
+         if( threads == 1 ) {
+            const auto start = clock::now();
+            for( std::size_t i = 0; i != iterations; ++i ) {
+               f();
+            }
+            return clock::now() - start;
+         }
+         std::latch ready( static_cast< std::ptrdiff_t >( threads + 1 ) );
+         std::latch go( 1 );
+         std::vector< std::thread > workers;
+         for( std::size_t t = 0; t != threads; ++t ) {
+            workers.emplace_back( [ & ] {
+               ready.count_down();
+               go.wait();
+               for( std::size_t i = 0; i != iterations; ++i ) {
+                  f();
+               }
+            } );
+         }
+         ready.arrive_and_wait();
+         const auto start = clock::now();
+         go.count_down();
+         for( auto& w : workers ) {
+            w.join();
+         }
+         return clock::now() - start;
+      }
+
+   public:
+      runner( const int argc, char** argv )
+         : m_filter( ( argc > 1 ) ? argv[ 1 ] : "" ),
+           m_sample_time( std::chrono::milliseconds( std::stoul( internal::getenv( "TAOPQ_BENCHMARK_TIME", "500" ) ) ) / samples )
+      {}
+
+      // f() performs one operation, with more than one thread f() is called concurrently
+      template< typename F >
+      void run( const std::string_view name, F&& f, const std::size_t threads = 1 )
+      {
+         if( name.find( m_filter ) == std::string_view::npos ) {
+            return;
+         }
+
+         // find the number of iterations that takes about the time of a sample
+         std::size_t iterations = 1;
+         while( true ) {
+            const auto elapsed = measure( threads, iterations, f );
+            if( elapsed >= m_sample_time / 4 ) {
+               const auto factor = static_cast< double >( m_sample_time.count() ) / static_cast< double >( std::max< std::chrono::nanoseconds::rep >( elapsed.count(), 1 ) );
+               iterations = std::max< std::size_t >( static_cast< std::size_t >( static_cast< double >( iterations ) * factor ), 1 );
+               break;
+            }
+            iterations *= 4;
+         }
+
+         std::vector< double > results;
+         for( std::size_t s = 0; s != samples; ++s ) {
+            const auto elapsed = measure( threads, iterations, f );
+            results.push_back( static_cast< double >( elapsed.count() ) / static_cast< double >( iterations * threads ) );
+         }
+         std::sort( results.begin(), results.end() );
+         const auto median = results[ samples / 2 ];
+
+         std::cout << std::format( "{{\"name\":\"{}\",\"threads\":{},\"iterations\":{},\"ns_per_op\":{:.2f},\"ns_per_op_min\":{:.2f},\"ops_per_second\":{:.0f}}}\n",
+                                   name,
+                                   threads,
+                                   iterations,
+                                   median,
+                                   results.front(),
+                                   1e9 / median );
+      }
+
+      // f( thread ) performs one operation that processes the given number of items (rows, statements, ...),
+      // each thread calls f() repeatedly for the benchmark time and the latency of each call is recorded.
+      template< typename F >
+      void run_workload( const std::string_view name, const std::size_t threads, const std::size_t items, F&& f )
+      {
+         if( name.find( m_filter ) == std::string_view::npos ) {
+            return;
+         }
+
+         std::vector< std::vector< std::chrono::nanoseconds > > latencies( threads );
+         std::latch ready( static_cast< std::ptrdiff_t >( threads ) );
+         std::latch go( 1 );
+         std::vector< std::thread > workers;
+         clock::time_point end;
+         for( std::size_t t = 0; t != threads; ++t ) {
+            workers.emplace_back( [ &, t ] {
+               f( t );  // warm-up
+               ready.count_down();
+               go.wait();
+               auto& l = latencies[ t ];
+               while( ( l.size() < min_operations ) || ( clock::now() < end ) ) {
+                  const auto start = clock::now();
+                  f( t );
+                  l.push_back( clock::now() - start );
+               }
+            } );
+         }
+         ready.wait();
+         const auto start = clock::now();
+         end = start + m_sample_time * samples;
+         go.count_down();
+         for( auto& w : workers ) {
+            w.join();
+         }
+         const auto elapsed = std::chrono::duration< double >( clock::now() - start ).count();
+
+         std::vector< std::chrono::nanoseconds > all;
+         for( const auto& l : latencies ) {
+            all.insert( all.end(), l.begin(), l.end() );
+         }
+         std::sort( all.begin(), all.end() );
+         const auto percentile = [ & ]( const std::size_t p ) {
+            return std::chrono::duration< double, std::micro >( all[ ( all.size() - 1 ) * p / 100 ] ).count();
+         };
+
+         std::cout << std::format( "{{\"name\":\"{}\",\"threads\":{},\"operations\":{},\"items_per_second\":{:.0f},\"p50_us\":{:.1f},\"p99_us\":{:.1f}}}\n",
+                                   name,
+                                   threads,
+                                   all.size(),
+                                   static_cast< double >( all.size() * items ) / elapsed,
+                                   percentile( 50 ),
+                                   percentile( 99 ) );
+      }
+   };
+
+}  // namespace tao::pq::internal::benchmark
+
+#endif